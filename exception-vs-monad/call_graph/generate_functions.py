@@ -0,0 +1,522 @@
+# Generates one random call graph and writes it either with exceptions or
+# with tl::expected, so both programs have exactly the same shape.
+#
+# Each of the max_groups roots starts a chain of max_depth + 1 layers, like the
+# depth generators. On top of that, a chain can merge into a function another
+# chain already calls, every function calls up to fan_out shared helpers, some
+# of them in a loop, and some functions handle the error of the next layer
+# instead of passing it on. Every function owns up to `destructors` objects
+# with non-trivial destructors. The same seed gives the same graph.
+#
+# REGEX to find number of functions in disassembly
+# ^[0-9a-f]+ <fallible_(function[0-9]+_group[0-9]+|helper[0-9]+)\(.*\)>:
+
+import argparse
+import pathlib
+import random
+import re
+import sys
+
+sys.path.insert(0, str(pathlib.Path(__file__).resolve().parents[1]))
+import split_sources  # noqa: E402
+
+_LICENSE = """
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+"""
+
+_COMMON_HEADER = """
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#else
+#define HARNESS_STATE
+#endif
+
+constexpr size_t error_size = @ERROR_SIZE@;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
+constexpr uint32_t depth_before_exception = 1000;
+#endif
+
+struct error_t
+{
+  std::array<std::uint8_t, error_size> data;
+};
+
+HARNESS_STATE volatile std::uint64_t enable_register;
+HARNESS_STATE volatile std::uint64_t trigger_register;
+HARNESS_STATE volatile int side_effect = 0;
+HARNESS_STATE volatile int handled_errors = 0;
+"""
+
+_EXCEPTION_HEADER = _LICENSE + """
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+""" + _COMMON_HEADER + """
+class non_trivial_destructor
+{
+public:
+  non_trivial_destructor(uint32_t p_channel)
+    : m_channel(p_channel)
+  {
+    if (p_channel >= depth_before_exception) {
+      throw error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } };
+    }
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
+  }
+
+  non_trivial_destructor(non_trivial_destructor&) = delete;
+  non_trivial_destructor& operator=(non_trivial_destructor&) = delete;
+  non_trivial_destructor(non_trivial_destructor&&) noexcept = default;
+  non_trivial_destructor& operator=(non_trivial_destructor&&) noexcept =
+    default;
+
+  ~non_trivial_destructor()
+  {
+    enable_register =
+      enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
+  }
+
+  void trigger()
+  {
+    if (m_channel >= depth_before_exception) {
+      throw error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } };
+    }
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
+  }
+
+private:
+  uint32_t m_channel = 0;
+};
+
+int return_error();
+int top_call()
+{
+  return return_error();
+}
+
+#if defined(HOST_BENCHMARK)
+int harness::call_top()
+#else
+int main()
+#endif
+{
+  volatile int return_code = 0;
+  try {
+    return_code = top_call();
+  } catch (const error_t& p_error) {
+    return p_error.data[0];
+  } catch (...) {
+    return 15;
+  }
+  return return_code;
+}
+
+#if !defined(HOST_BENCHMARK)
+extern "C"
+{
+  void _exit([[maybe_unused]] int rc)
+  {
+    while (true) {
+      continue;
+    }
+  }
+
+  int kill(int, int)
+  {
+    return -1;
+  }
+
+  struct _reent* _impure_ptr = nullptr;
+
+  int getpid()
+  {
+    return 1;
+  }
+}
+
+[[noreturn]] void my_terminate() noexcept
+{
+  while (true) {
+    continue;
+  }
+}
+
+namespace __cxxabiv1 {
+std::terminate_handler __terminate_handler = my_terminate;
+}
+#endif
+
+// =============================================================================
+// Add generated code below
+// =============================================================================
+"""
+
+_EXPECTED_HEADER = _LICENSE + """
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <tl/expected.hpp>
+""" + _COMMON_HEADER + """
+class non_trivial_destructor
+{
+public:
+  static tl::expected<non_trivial_destructor, error_t> initialize(
+    uint32_t p_channel)
+  {
+    if (p_channel >= depth_before_exception) {
+      return tl::unexpected(error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } });
+    }
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
+    return non_trivial_destructor{ p_channel };
+  }
+
+  non_trivial_destructor(non_trivial_destructor&) = delete;
+  non_trivial_destructor& operator=(non_trivial_destructor&) = delete;
+  non_trivial_destructor(non_trivial_destructor&&) noexcept = default;
+  non_trivial_destructor& operator=(non_trivial_destructor&&) noexcept =
+    default;
+
+  tl::expected<void, error_t> trigger()
+  {
+    if (m_channel >= depth_before_exception) {
+      return tl::unexpected(error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } });
+    }
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
+
+    return {};
+  }
+
+  ~non_trivial_destructor()
+  {
+    enable_register =
+      enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
+  }
+
+private:
+  non_trivial_destructor(uint32_t p_channel)
+    : m_channel(p_channel)
+  {
+  }
+
+  uint32_t m_channel = 0;
+};
+
+tl::expected<int, error_t> return_error();
+tl::expected<int, error_t> top_call()
+{
+  auto result = return_error();
+  if (!result) {
+    return tl::unexpected(result.error());
+  }
+  return result.value();
+}
+
+#if defined(HOST_BENCHMARK)
+int harness::call_top()
+#else
+int main()
+#endif
+{
+  auto result = top_call();
+  if (!result) {
+    return static_cast<int>(result.error().data[0]);
+  }
+  return result.value();
+}
+
+// =============================================================================
+// Add generated code below
+// =============================================================================
+"""
+
+_HOST_HOOKS_FORMAT = """
+#if defined(HOST_BENCHMARK)
+// Fail in the last layer so the error starts in the deepest frames
+const std::uint32_t harness::failing_threshold = {max_depth};
+const harness::result_layout harness::layout =
+  harness::describe<error_t, decltype(top_call())>();
+#endif
+"""
+
+
+class Function:
+    def __init__(self, name: str, parameters: str, channel: str,
+                 destructors: int):
+        self.name = name
+        self.parameters = parameters
+        # Expression for the channel of the function's objects
+        self.channel = channel
+        self.destructors = destructors
+        # (callee, call arguments, loop iterations, handled) in call order
+        self.calls = []
+
+
+class Graph:
+    def __init__(self, max_groups: int, max_depth: int, seed: int,
+                 fan_out: int, helpers: int, destructors: int,
+                 merge_rate: float, loop_rate: float, handle_rate: float):
+        generator = random.Random(seed)
+        self.max_depth = max_depth
+        # Helpers fail like their caller's layer, so they always own at
+        # least one object that can fail
+        self.helpers = [Function(f"fallible_helper{index}",
+                                 "std::uint32_t p_channel", "p_channel",
+                                 generator.randint(1, max(destructors, 1)))
+                        for index in range(helpers)]
+
+        self.layers = [[self._function(generator, 0, group, destructors)
+                        for group in range(max_groups)]]
+        for depth in range(1, max_depth + 1):
+            layer = []
+            for caller in self.layers[-1]:
+                if layer and generator.random() < merge_rate:
+                    callee = generator.choice(layer)
+                else:
+                    callee = self._function(generator, depth, len(layer),
+                                            destructors)
+                    layer.append(callee)
+                handled = generator.random() < handle_rate
+                caller.calls.append((callee, "", 1, handled))
+            self.layers.append(layer)
+
+        # Helper calls go in at random positions around the next layer call
+        for depth, layer in enumerate(self.layers):
+            for function in layer:
+                for _ in range(generator.randint(0, fan_out)
+                               if self.helpers else 0):
+                    iterations = (generator.randint(2, 4)
+                                  if generator.random() < loop_rate else 1)
+                    call = (generator.choice(self.helpers), str(depth),
+                            iterations, False)
+                    function.calls.insert(
+                        generator.randint(0, len(function.calls)), call)
+
+    def _function(self, generator, depth: int, index: int,
+                  destructors: int) -> Function:
+        # The last layer is where the error starts, so it must be able to fail
+        least = 1 if depth == self.max_depth else 0
+        count = generator.randint(least, max(destructors, least))
+        return Function(f"fallible_function{depth}_group{index}", "",
+                        str(depth), count)
+
+    def functions(self) -> list:
+        """Callees before callers, so no forward declarations are needed"""
+        return [*self.helpers,
+                *(function for layer in reversed(self.layers)
+                  for function in layer)]
+
+    def roots(self) -> list:
+        return self.layers[0]
+
+
+def exception_signature(function: Function) -> str:
+    return f"int {function.name}({function.parameters})"
+
+
+def expected_signature(function: Function) -> str:
+    return f"tl::expected<int, error_t> {function.name}({function.parameters})"
+
+
+def exception_function(function: Function) -> str:
+    lines = [exception_signature(function), "{"]
+    for index in range(function.destructors):
+        lines += [f"  auto object{index} = "
+                  f"non_trivial_destructor({function.channel});",
+                  f"  object{index}.trigger();"]
+    for callee, arguments, iterations, handled in function.calls:
+        call = [f"side_effect = side_effect + {callee.name}({arguments});"]
+        if handled:
+            call = ["try {", *(f"  {line}" for line in call),
+                    "} catch (const error_t&) {",
+                    "  handled_errors = handled_errors + 1;", "}"]
+        if iterations > 1:
+            call = [f"for (int i = 0; i < {iterations}; i++) {{",
+                    *(f"  {line}" for line in call), "}"]
+        lines += [f"  {line}" for line in call]
+    lines += ["  return side_effect;", "}"]
+    return "\n".join(lines)
+
+
+def expected_function(function: Function) -> str:
+    lines = [expected_signature(function), "{"]
+    for index in range(function.destructors):
+        lines += [
+            f"  auto object{index} = "
+            f"non_trivial_destructor::initialize({function.channel});",
+            f"  if (!object{index}) {{",
+            f"    return tl::unexpected(object{index}.error());",
+            "  }",
+            f"  if (auto result = object{index}.value().trigger(); !result) {{",
+            "    return tl::unexpected(result.error());",
+            "  }"]
+    for callee, arguments, iterations, handled in function.calls:
+        on_error = ("handled_errors = handled_errors + 1;" if handled else
+                    "return tl::unexpected(result.error());")
+        call = [f"if (auto result = {callee.name}({arguments}); result) {{",
+                "  side_effect = side_effect + result.value();",
+                "} else {",
+                f"  {on_error}",
+                "}"]
+        if iterations > 1:
+            call = [f"for (int i = 0; i < {iterations}; i++) {{",
+                    *(f"  {line}" for line in call), "}"]
+        lines += [f"  {line}" for line in call]
+    lines += ["  return side_effect;", "}"]
+    return "\n".join(lines)
+
+
+_STYLES = {
+    "exception": (_EXCEPTION_HEADER, exception_signature, exception_function),
+    "expected": (_EXPECTED_HEADER, expected_signature, expected_function),
+}
+
+# Where the part after the shared declarations starts, to split the header
+# when writing several translation units
+_PROGRAM_START = re.compile(r"^.* return_error\(\);\n", re.MULTILINE)
+
+
+def return_error(graph: Graph, style: str) -> str:
+    if style == "exception":
+        calls = [f"  {root.name}();" for root in graph.roots()]
+        return "\n".join(["int return_error()", "{", *calls,
+                          "  return side_effect;", "}"])
+    calls = [line for root in graph.roots() for line in [
+        f"  if (auto result = {root.name}(); !result) {{",
+        "    return tl::unexpected(result.error());",
+        "  }"]]
+    return "\n".join(["tl::expected<int, error_t> return_error()", "{",
+                      *calls, "  return side_effect;", "}"])
+
+
+def error_size(text: str) -> int:
+    """error_t is initialized with 4 bytes, so it cannot be any smaller"""
+    size = int(text)
+    if size < 4:
+        raise argparse.ArgumentTypeError(f"{size} is smaller than 4 bytes")
+    return size
+
+
+def rate(text: str) -> float:
+    value = float(text)
+    if not 0 <= value <= 1:
+        raise argparse.ArgumentTypeError(f"{value} is not between 0 and 1")
+    return value
+
+
+def do_the_thing(graph: Graph, style: str, error_size: int = 128,
+                 translation_units: int = 1, output_directory: str = None):
+    header, signature, write_function = _STYLES[style]
+    header = header.replace("@ERROR_SIZE@", str(error_size))
+    hooks = _HOST_HOOKS_FORMAT.format(max_depth=graph.max_depth)
+    if translation_units == 1:
+        functions = [write_function(function)
+                     for function in graph.functions()]
+        program = "\n".join([
+            header,
+            hooks,
+            "\n\n".join(functions),
+            "",
+            return_error(graph, style),
+        ])
+        if output_directory is None:
+            print(program)
+        else:
+            split_sources.write_units(output_directory,
+                                      [("main.cpp", program)])
+        return
+
+    # Helper n goes to unit n % translation_units and layer d to unit
+    # d % translation_units, so most calls cross into another unit
+    functions_per_unit = [[] for _ in range(translation_units)]
+    for index, helper in enumerate(graph.helpers):
+        functions_per_unit[index % translation_units].append(helper)
+    for depth, layer in enumerate(graph.layers):
+        functions_per_unit[depth % translation_units].extend(layer)
+
+    license, declarations, program = split_sources.split_header(
+        header, _PROGRAM_START)
+    include = license + '\n#include "common.hpp"\n'
+    units = [
+        ("common.hpp", "\n".join([
+            license + "\n#pragma once",
+            split_sources.shareable(declarations),
+            *(f"{signature(function)};"
+              for function in graph.functions()),
+        ])),
+        ("main.cpp", "\n".join([
+            include + program,
+            hooks,
+            *(write_function(function) + "\n"
+              for function in functions_per_unit[0]),
+            return_error(graph, style),
+        ])),
+    ]
+    units += [(f"unit{unit}.cpp", "\n".join([
+        include, *(write_function(function) + "\n"
+                   for function in functions)]))
+              for unit, functions in enumerate(functions_per_unit)
+              if unit > 0]
+    split_sources.write_units(output_directory, units)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-s", "--style", required=True, choices=list(_STYLES),
+                        help="How errors are reported")
+    parser.add_argument("-g", "--max_groups",
+                        help="Number of roots", default=10, type=int)
+    parser.add_argument("-d", "--max_depth",
+                        help="Layers below each root", default=15, type=int)
+    parser.add_argument("-e", "--error_size", type=error_size, default=128,
+                        help="Bytes in error_t, at least 4")
+    parser.add_argument("--seed", default=1, type=int)
+    parser.add_argument("--fan_out", default=2, type=int,
+                        help="Most helper calls per function")
+    parser.add_argument("--helpers", default=8, type=int,
+                        help="Number of shared helper functions")
+    parser.add_argument("--destructors", default=2, type=int,
+                        help="Most objects with destructors per function")
+    parser.add_argument("--merge_rate", default=0.25, type=rate,
+                        help="Chance a chain merges into a function already "
+                        "called from the layer above")
+    parser.add_argument("--loop_rate", default=0.25, type=rate,
+                        help="Chance a helper is called in a loop")
+    parser.add_argument("--handle_rate", default=0.1, type=rate,
+                        help="Chance a function handles the next layer's "
+                        "error instead of passing it up")
+    parser.add_argument("-u", "--translation_units", default=1, type=int,
+                        help="Source files to spread the functions over")
+    parser.add_argument("-o", "--output_directory",
+                        help="Write main.cpp (and with more than one unit, "
+                        "common.hpp and unitN.cpp) here instead of stdout")
+    args = parser.parse_args()
+    if args.translation_units > 1 and args.output_directory is None:
+        parser.error("--translation_units needs --output_directory")
+    graph = Graph(max_groups=args.max_groups, max_depth=args.max_depth,
+                  seed=args.seed, fan_out=args.fan_out, helpers=args.helpers,
+                  destructors=args.destructors, merge_rate=args.merge_rate,
+                  loop_rate=args.loop_rate, handle_rate=args.handle_rate)
+    do_the_thing(graph, style=args.style, error_size=args.error_size,
+                 translation_units=args.translation_units,
+                 output_directory=args.output_directory)
@@ -0,0 +1,187 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Result type that keeps the error payload out of the return value.
+//
+// `tl::expected<int, error_t>` is as big as error_t, so with a 128 byte error
+// every frame returns through memory and copies the payload on the way up.
+// `compact::result<T, E>` holds a T and a one byte error code. The E itself
+// is written once by raise() into a side channel slot, one per error type,
+// and every frame above only forwards the code. result<void, E> is the code
+// alone.
+//
+// There is one slot per error type, so only the latest error is kept. That
+// is enough for errors that propagate straight up, like the benchmarks here.
+// The slot is static. Define COMPACT_RESULT_THREAD_LOCAL to make it
+// thread_local instead.
+namespace compact {
+/// Error code carried by a result. Zero means success.
+using code = std::uint8_t;
+
+#if defined(COMPACT_RESULT_THREAD_LOCAL)
+template<typename E>
+thread_local E slot{};
+#else
+template<typename E>
+inline E slot{};
+#endif
+
+/// Converts to any result as its error. Returned by raise() and
+/// forward_error().
+struct failure
+{
+  code value;
+};
+
+/// Stores p_error in E's slot and returns the code that refers to it
+template<typename E>
+failure raise(E p_error)
+{
+  slot<E> = std::move(p_error);
+  return { 1 };
+}
+
+template<typename T, typename E>
+class result
+{
+public:
+  result(T p_value)
+    : m_value(std::move(p_value))
+  {
+  }
+
+  result(failure p_failure)
+    : m_code(p_failure.value)
+  {
+  }
+
+  // Copy and move stay trivial when T's are, so the result of a trivially
+  // copyable T is trivial for the purposes of calls.
+  result(const result&)
+    requires std::is_trivially_copy_constructible_v<T>
+  = default;
+  result(const result& p_other)
+    requires(!std::is_trivially_copy_constructible_v<T>)
+    : m_code(p_other.m_code)
+  {
+    if (m_code == 0) {
+      ::new (&m_value) T(p_other.m_value);
+    }
+  }
+
+  result(result&&)
+    requires std::is_trivially_move_constructible_v<T>
+  = default;
+  result(result&& p_other)
+    requires(!std::is_trivially_move_constructible_v<T>)
+    : m_code(p_other.m_code)
+  {
+    if (m_code == 0) {
+      ::new (&m_value) T(std::move(p_other.m_value));
+    }
+  }
+
+  // Results are returned and inspected, never reassigned
+  result& operator=(const result&) = delete;
+  result& operator=(result&&) = delete;
+
+  ~result()
+    requires std::is_trivially_destructible_v<T>
+  = default;
+  ~result()
+    requires(!std::is_trivially_destructible_v<T>)
+  {
+    if (m_code == 0) {
+      m_value.~T();
+    }
+  }
+
+  bool has_value() const
+  {
+    return m_code == 0;
+  }
+
+  explicit operator bool() const
+  {
+    return has_value();
+  }
+
+  T& value()
+  {
+    return m_value;
+  }
+
+  /// The payload raise() stored for this result's error
+  const E& error() const
+  {
+    return slot<E>;
+  }
+
+  /// This result's error, to return from the caller without touching the
+  /// payload
+  failure forward_error() const
+  {
+    return { m_code };
+  }
+
+private:
+  union
+  {
+    T m_value;
+  };
+  code m_code = 0;
+};
+
+template<typename E>
+class result<void, E>
+{
+public:
+  result() = default;
+
+  result(failure p_failure)
+    : m_code(p_failure.value)
+  {
+  }
+
+  bool has_value() const
+  {
+    return m_code == 0;
+  }
+
+  explicit operator bool() const
+  {
+    return has_value();
+  }
+
+  const E& error() const
+  {
+    return slot<E>;
+  }
+
+  failure forward_error() const
+  {
+    return { m_code };
+  }
+
+private:
+  code m_code = 0;
+};
+}  // namespace compact
@@ -0,0 +1,312 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <utility>
+
+// Coroutine task whose errors short-circuit the whole chain of awaiting
+// coroutines.
+//
+// `coro::task<T, E>` is started lazily. Awaiting one hands control to it by
+// symmetric transfer. When it finishes, it transfers back to the coroutine
+// that awaited it. Tasks and result types with has_value(), value() and
+// error(), such as tl::expected, can be awaited. When an awaited result
+// holds an error, the promise writes the error into the failure the chain
+// was started with. It then suspends the chain and returns to whoever
+// called run(). None of the coroutines between the failure and run() are
+// resumed. Destroying the root task then destroys every suspended frame and
+// their locals, the way unwinding would.
+//
+// Frames come from the global operator new. Define
+// COROUTINE_FRAME_ARENA_BYTES to take them from a static arena instead. The
+// frames of a chain are freed in the reverse order they were allocated in,
+// so the arena is a stack. Running out of it calls std::terminate().
+namespace coro {
+/// Frame allocations since the last reset_frame_statistics()
+struct frame_statistics
+{
+  std::uint32_t allocations = 0;
+  std::size_t allocated_bytes = 0;
+  /// Most frame bytes alive at once
+  std::size_t high_water_bytes = 0;
+  std::size_t largest_frame_bytes = 0;
+};
+
+namespace detail {
+inline frame_statistics statistics;
+inline std::size_t live_bytes = 0;
+
+#if defined(COROUTINE_FRAME_ARENA_BYTES)
+constexpr std::size_t frame_alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+alignas(frame_alignment) inline std::array<std::byte,
+                                           COROUTINE_FRAME_ARENA_BYTES> arena;
+inline std::size_t arena_top = 0;
+
+constexpr std::size_t arena_bytes(std::size_t p_bytes)
+{
+  return (p_bytes + frame_alignment - 1) / frame_alignment * frame_alignment;
+}
+#endif
+
+inline void* allocate_frame(std::size_t p_bytes)
+{
+  statistics.allocations++;
+  statistics.allocated_bytes += p_bytes;
+  live_bytes += p_bytes;
+  if (live_bytes > statistics.high_water_bytes) {
+    statistics.high_water_bytes = live_bytes;
+  }
+  if (p_bytes > statistics.largest_frame_bytes) {
+    statistics.largest_frame_bytes = p_bytes;
+  }
+#if defined(COROUTINE_FRAME_ARENA_BYTES)
+  if (arena_top + arena_bytes(p_bytes) > arena.size()) {
+    std::terminate();
+  }
+  void* frame = arena.data() + arena_top;
+  arena_top += arena_bytes(p_bytes);
+  return frame;
+#else
+  return ::operator new(p_bytes);
+#endif
+}
+
+inline void free_frame(void* p_frame, std::size_t p_bytes)
+{
+  live_bytes -= p_bytes;
+#if defined(COROUTINE_FRAME_ARENA_BYTES)
+  arena_top -= arena_bytes(p_bytes);
+  // Only the newest frame can be freed
+  if (p_frame != arena.data() + arena_top) {
+    std::terminate();
+  }
+#else
+  ::operator delete(p_frame, p_bytes);
+#endif
+}
+
+}  // namespace detail
+
+inline frame_statistics get_frame_statistics()
+{
+  return detail::statistics;
+}
+
+inline void reset_frame_statistics()
+{
+  detail::statistics = {};
+}
+
+/// Where a chain of tasks leaves its error, owned by the caller of run()
+template<typename E>
+struct failure
+{
+  E error;
+  bool failed = false;
+};
+
+template<typename T, typename E>
+class task;
+
+namespace detail {
+/// co_await on another task: it runs now and comes back here when done
+template<typename U, typename E>
+struct task_awaiter
+{
+  task<U, E> m_task;
+
+  bool await_ready() noexcept
+  {
+    return false;
+  }
+
+  template<typename Promise>
+  std::coroutine_handle<> await_suspend(
+    std::coroutine_handle<Promise> p_caller) noexcept
+  {
+    auto& callee = m_task.m_handle.promise();
+    callee.m_continuation = p_caller;
+    callee.m_failure = p_caller.promise().m_failure;
+    return m_task.m_handle;
+  }
+
+  U await_resume() noexcept
+  {
+    return std::move(m_task.m_handle.promise().m_value);
+  }
+};
+
+/// co_await on a finished result: its value, or its error for the chain
+template<typename Result>
+struct result_awaiter
+{
+  Result m_result;
+
+  bool await_ready() noexcept
+  {
+    return m_result.has_value();
+  }
+
+  template<typename Promise>
+  std::coroutine_handle<> await_suspend(
+    std::coroutine_handle<Promise> p_caller) noexcept
+  {
+    auto* failure = p_caller.promise().m_failure;
+    failure->error = m_result.error();
+    failure->failed = true;
+    // Straight back to run(), nothing in between is resumed
+    return std::noop_coroutine();
+  }
+
+  decltype(auto) await_resume() noexcept
+  {
+    if constexpr (requires { std::move(m_result.value()); }) {
+      return std::move(m_result.value());
+    }
+  }
+};
+
+struct final_awaiter
+{
+  bool await_ready() noexcept
+  {
+    return false;
+  }
+
+  template<typename Promise>
+  std::coroutine_handle<> await_suspend(
+    std::coroutine_handle<Promise> p_finished) noexcept
+  {
+    return p_finished.promise().m_continuation;
+  }
+
+  void await_resume() noexcept
+  {
+  }
+};
+
+template<typename E>
+struct promise_base
+{
+  static void* operator new(std::size_t p_bytes)
+  {
+    return allocate_frame(p_bytes);
+  }
+
+  static void operator delete(void* p_frame, std::size_t p_bytes)
+  {
+    free_frame(p_frame, p_bytes);
+  }
+
+  std::suspend_always initial_suspend() noexcept
+  {
+    return {};
+  }
+
+  final_awaiter final_suspend() noexcept
+  {
+    return {};
+  }
+
+  void unhandled_exception() noexcept
+  {
+    std::terminate();
+  }
+
+  template<typename U>
+  task_awaiter<U, E> await_transform(task<U, E>&& p_task) noexcept
+  {
+    return { std::move(p_task) };
+  }
+
+  template<typename Result>
+  result_awaiter<Result> await_transform(Result&& p_result) noexcept
+  {
+    return { std::forward<Result>(p_result) };
+  }
+
+  std::coroutine_handle<> m_continuation = std::noop_coroutine();
+  failure<E>* m_failure = nullptr;
+};
+}  // namespace detail
+
+template<typename T, typename E>
+class [[nodiscard]] task
+{
+public:
+  class promise_type : public detail::promise_base<E>
+  {
+  public:
+    task get_return_object() noexcept
+    {
+      return task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+    }
+
+    void return_value(T p_value) noexcept
+    {
+      m_value = std::move(p_value);
+    }
+
+    T m_value{};
+  };
+
+  task(task&& p_other) noexcept
+    : m_handle(std::exchange(p_other.m_handle, nullptr))
+  {
+  }
+
+  task(const task&) = delete;
+  task& operator=(const task&) = delete;
+  task& operator=(task&&) = delete;
+
+  ~task()
+  {
+    if (m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  /// Runs the chain until it finishes or fails. Returns whether it finished.
+  bool run(failure<E>& p_failure)
+  {
+    m_handle.promise().m_failure = &p_failure;
+    m_handle.resume();
+    return !p_failure.failed;
+  }
+
+  /// The value co_returned, once run() has returned true
+  T& value()
+  {
+    return m_handle.promise().m_value;
+  }
+
+private:
+  template<typename, typename>
+  friend struct detail::task_awaiter;
+
+  explicit task(std::coroutine_handle<promise_type> p_handle) noexcept
+    : m_handle(p_handle)
+  {
+  }
+
+  std::coroutine_handle<promise_type> m_handle;
+};
+}  // namespace coro
@@ -0,0 +1,271 @@
+# Generates a catch site with catch_clauses handlers for an error thrown from
+# the bottom of a hierarchy_depth deep class hierarchy.
+#
+# The thrown type is error_level{hierarchy_depth - 1}, which derives from
+# error_level{hierarchy_depth - 2} and so on down to error_level0. The catch
+# site lists catch_clauses - 1 unrelated polymorphic types before the clause
+# that takes error_level0, so the personality routine rules out every one of
+# them and walks the whole hierarchy for each. One clause and a depth of one
+# is the flat case, which throws and catches error_t itself, with no vtable
+# pointer in the thrown object.
+
+import argparse
+
+_FILE_HEADER = """
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#else
+#define HARNESS_STATE
+#endif
+
+constexpr size_t error_size = @ERROR_SIZE@;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
+constexpr uint32_t depth_before_exception = 1000;
+#endif
+
+struct error_t
+{
+  std::array<std::uint8_t, error_size> data;
+};
+
+HARNESS_STATE volatile std::uint64_t enable_register;
+HARNESS_STATE volatile std::uint64_t trigger_register;
+HARNESS_STATE volatile int side_effect = 0;
+
+// Root of the thrown hierarchy, carrying the same payload as error_t
+class error_level0
+{
+public:
+  explicit error_level0(std::uint8_t p_code)
+    : m_error{ .data = { p_code } }
+  {
+  }
+
+  virtual ~error_level0() = default;
+
+  const error_t& error() const
+  {
+    return m_error;
+  }
+
+private:
+  error_t m_error;
+};
+"""
+
+_LEVEL_FORMAT = """
+class error_level{level} : public error_level{base}
+{{
+public:
+  using error_level{base}::error_level{base};
+}};
+"""
+
+_UNRELATED_FORMAT = """
+class unrelated_error{index}
+{{
+public:
+  virtual ~unrelated_error{index}() = default;
+}};
+"""
+
+_PROGRAM_FORMAT = """
+using thrown_error = {thrown};
+
+class non_trivial_destructor
+{{
+public:
+  non_trivial_destructor(uint32_t p_channel)
+    : m_channel(p_channel)
+  {{
+    enable_register =
+      enable_register | (std::uint64_t{{ 1 }} << (p_channel % 64));
+  }}
+
+  non_trivial_destructor(non_trivial_destructor&) = delete;
+  non_trivial_destructor& operator=(non_trivial_destructor&) = delete;
+  non_trivial_destructor(non_trivial_destructor&&) noexcept = default;
+  non_trivial_destructor& operator=(non_trivial_destructor&&) noexcept =
+    default;
+
+  ~non_trivial_destructor()
+  {{
+    enable_register =
+      enable_register & ~(std::uint64_t{{ 1 }} << (m_channel % 64));
+  }}
+
+  void trigger()
+  {{
+    if (m_channel >= depth_before_exception) {{
+      throw thrown_error{{ 0xAA }};
+    }}
+    trigger_register =
+      trigger_register | (std::uint64_t{{ 1 }} << (m_channel % 64));
+  }}
+
+private:
+  uint32_t m_channel = 0;
+}};
+
+int fallible_function1()
+{{
+  auto result = non_trivial_destructor(1);
+  result.trigger();
+  return side_effect + 1;
+}}
+
+int fallible_function0()
+{{
+  auto result = non_trivial_destructor(0);
+  result.trigger();
+  side_effect = side_effect + fallible_function1();
+  return side_effect;
+}}
+
+int top_call()
+{{
+  return fallible_function0();
+}}
+
+#if defined(HOST_BENCHMARK)
+// Fail in the deepest frame
+const std::uint32_t harness::failing_threshold = 1;
+const harness::result_layout harness::layout =
+  harness::describe<thrown_error, decltype(top_call())>();
+int harness::call_top()
+#else
+int main()
+#endif
+{{
+  volatile int return_code = 0;
+  try {{
+    return_code = top_call();
+  }}{unrelated_clauses}{matching_clause} catch (...) {{
+    return 15;
+  }}
+  return return_code;
+}}
+
+#if !defined(HOST_BENCHMARK)
+extern "C"
+{{
+  void _exit([[maybe_unused]] int rc)
+  {{
+    while (true) {{
+      continue;
+    }}
+  }}
+
+  int kill(int, int)
+  {{
+    return -1;
+  }}
+
+  struct _reent* _impure_ptr = nullptr;
+
+  int getpid()
+  {{
+    return 1;
+  }}
+}}
+
+[[noreturn]] void my_terminate() noexcept
+{{
+  while (true) {{
+    continue;
+  }}
+}}
+
+namespace __cxxabiv1 {{
+std::terminate_handler __terminate_handler = my_terminate;
+}}
+#endif"""
+
+_UNRELATED_CLAUSE_FORMAT = """ catch (const unrelated_error{index}&) {{
+    return {code};
+  }}"""
+
+_HIERARCHY_CLAUSE = """ catch (const error_level0& p_error) {
+    return p_error.error().data[0];
+  }"""
+
+_FLAT_CLAUSE = """ catch (const error_t& p_error) {
+    return p_error.data[0];
+  }"""
+
+
+def at_least_one(text: str) -> int:
+    value = int(text)
+    if value < 1:
+        raise argparse.ArgumentTypeError(f"{value} is smaller than 1")
+    return value
+
+
+def error_size(text: str) -> int:
+    """error_level0 is initialized with 1 byte, keep the 4 of error_t"""
+    size = int(text)
+    if size < 4:
+        raise argparse.ArgumentTypeError(f"{size} is smaller than 4 bytes")
+    return size
+
+
+def do_the_thing(catch_clauses: int, hierarchy_depth: int,
+                 error_size: int = 128):
+    levels = [_LEVEL_FORMAT.format(level=level, base=level - 1)
+              for level in range(1, hierarchy_depth)]
+    unrelated = [_UNRELATED_FORMAT.format(index=index)
+                 for index in range(catch_clauses - 1)]
+    clauses = [_UNRELATED_CLAUSE_FORMAT.format(index=index, code=16 + index)
+               for index in range(catch_clauses - 1)]
+
+    flat = catch_clauses == 1 and hierarchy_depth == 1
+
+    print("".join([
+        _FILE_HEADER.replace("@ERROR_SIZE@", str(error_size)),
+        *levels,
+        *unrelated,
+        _PROGRAM_FORMAT.format(
+            thrown=("error_t" if flat
+                    else f"error_level{hierarchy_depth - 1}"),
+            unrelated_clauses="".join(clauses),
+            matching_clause=_FLAT_CLAUSE if flat else _HIERARCHY_CLAUSE),
+    ]))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-c", "--catch_clauses", default=16,
+                        type=at_least_one,
+                        help="Catch clauses before catch (...), the last one "
+                        "matches")
+    parser.add_argument("-H", "--hierarchy_depth", default=8,
+                        type=at_least_one,
+                        help="Classes from error_level0 to the thrown type")
+    parser.add_argument("-e", "--error_size", type=error_size, default=128,
+                        help="Bytes in error_t, at least 4")
+    args = parser.parse_args()
+    do_the_thing(catch_clauses=args.catch_clauses,
+                 hierarchy_depth=args.hierarchy_depth,
+                 error_size=args.error_size)
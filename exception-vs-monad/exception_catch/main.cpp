@@ -0,0 +1,337 @@
+
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#else
+#define HARNESS_STATE
+#endif
+
+constexpr size_t error_size = 128;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
+constexpr uint32_t depth_before_exception = 1000;
+#endif
+
+struct error_t
+{
+  std::array<std::uint8_t, error_size> data;
+};
+
+HARNESS_STATE volatile std::uint64_t enable_register;
+HARNESS_STATE volatile std::uint64_t trigger_register;
+HARNESS_STATE volatile int side_effect = 0;
+
+// Root of the thrown hierarchy, carrying the same payload as error_t
+class error_level0
+{
+public:
+  explicit error_level0(std::uint8_t p_code)
+    : m_error{ .data = { p_code } }
+  {
+  }
+
+  virtual ~error_level0() = default;
+
+  const error_t& error() const
+  {
+    return m_error;
+  }
+
+private:
+  error_t m_error;
+};
+
+class error_level1 : public error_level0
+{
+public:
+  using error_level0::error_level0;
+};
+
+class error_level2 : public error_level1
+{
+public:
+  using error_level1::error_level1;
+};
+
+class error_level3 : public error_level2
+{
+public:
+  using error_level2::error_level2;
+};
+
+class error_level4 : public error_level3
+{
+public:
+  using error_level3::error_level3;
+};
+
+class error_level5 : public error_level4
+{
+public:
+  using error_level4::error_level4;
+};
+
+class error_level6 : public error_level5
+{
+public:
+  using error_level5::error_level5;
+};
+
+class error_level7 : public error_level6
+{
+public:
+  using error_level6::error_level6;
+};
+
+class unrelated_error0
+{
+public:
+  virtual ~unrelated_error0() = default;
+};
+
+class unrelated_error1
+{
+public:
+  virtual ~unrelated_error1() = default;
+};
+
+class unrelated_error2
+{
+public:
+  virtual ~unrelated_error2() = default;
+};
+
+class unrelated_error3
+{
+public:
+  virtual ~unrelated_error3() = default;
+};
+
+class unrelated_error4
+{
+public:
+  virtual ~unrelated_error4() = default;
+};
+
+class unrelated_error5
+{
+public:
+  virtual ~unrelated_error5() = default;
+};
+
+class unrelated_error6
+{
+public:
+  virtual ~unrelated_error6() = default;
+};
+
+class unrelated_error7
+{
+public:
+  virtual ~unrelated_error7() = default;
+};
+
+class unrelated_error8
+{
+public:
+  virtual ~unrelated_error8() = default;
+};
+
+class unrelated_error9
+{
+public:
+  virtual ~unrelated_error9() = default;
+};
+
+class unrelated_error10
+{
+public:
+  virtual ~unrelated_error10() = default;
+};
+
+class unrelated_error11
+{
+public:
+  virtual ~unrelated_error11() = default;
+};
+
+class unrelated_error12
+{
+public:
+  virtual ~unrelated_error12() = default;
+};
+
+class unrelated_error13
+{
+public:
+  virtual ~unrelated_error13() = default;
+};
+
+class unrelated_error14
+{
+public:
+  virtual ~unrelated_error14() = default;
+};
+
+using thrown_error = error_level7;
+
+class non_trivial_destructor
+{
+public:
+  non_trivial_destructor(uint32_t p_channel)
+    : m_channel(p_channel)
+  {
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
+  }
+
+  non_trivial_destructor(non_trivial_destructor&) = delete;
+  non_trivial_destructor& operator=(non_trivial_destructor&) = delete;
+  non_trivial_destructor(non_trivial_destructor&&) noexcept = default;
+  non_trivial_destructor& operator=(non_trivial_destructor&&) noexcept =
+    default;
+
+  ~non_trivial_destructor()
+  {
+    enable_register =
+      enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
+  }
+
+  void trigger()
+  {
+    if (m_channel >= depth_before_exception) {
+      throw thrown_error{ 0xAA };
+    }
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
+  }
+
+private:
+  uint32_t m_channel = 0;
+};
+
+int fallible_function1()
+{
+  auto result = non_trivial_destructor(1);
+  result.trigger();
+  return side_effect + 1;
+}
+
+int fallible_function0()
+{
+  auto result = non_trivial_destructor(0);
+  result.trigger();
+  side_effect = side_effect + fallible_function1();
+  return side_effect;
+}
+
+int top_call()
+{
+  return fallible_function0();
+}
+
+#if defined(HOST_BENCHMARK)
+// Fail in the deepest frame
+const std::uint32_t harness::failing_threshold = 1;
+const harness::result_layout harness::layout =
+  harness::describe<thrown_error, decltype(top_call())>();
+int harness::call_top()
+#else
+int main()
+#endif
+{
+  volatile int return_code = 0;
+  try {
+    return_code = top_call();
+  } catch (const unrelated_error0&) {
+    return 16;
+  } catch (const unrelated_error1&) {
+    return 17;
+  } catch (const unrelated_error2&) {
+    return 18;
+  } catch (const unrelated_error3&) {
+    return 19;
+  } catch (const unrelated_error4&) {
+    return 20;
+  } catch (const unrelated_error5&) {
+    return 21;
+  } catch (const unrelated_error6&) {
+    return 22;
+  } catch (const unrelated_error7&) {
+    return 23;
+  } catch (const unrelated_error8&) {
+    return 24;
+  } catch (const unrelated_error9&) {
+    return 25;
+  } catch (const unrelated_error10&) {
+    return 26;
+  } catch (const unrelated_error11&) {
+    return 27;
+  } catch (const unrelated_error12&) {
+    return 28;
+  } catch (const unrelated_error13&) {
+    return 29;
+  } catch (const unrelated_error14&) {
+    return 30;
+  } catch (const error_level0& p_error) {
+    return p_error.error().data[0];
+  } catch (...) {
+    return 15;
+  }
+  return return_code;
+}
+
+#if !defined(HOST_BENCHMARK)
+extern "C"
+{
+  void _exit([[maybe_unused]] int rc)
+  {
+    while (true) {
+      continue;
+    }
+  }
+
+  int kill(int, int)
+  {
+    return -1;
+  }
+
+  struct _reent* _impure_ptr = nullptr;
+
+  int getpid()
+  {
+    return 1;
+  }
+}
+
+[[noreturn]] void my_terminate() noexcept
+{
+  while (true) {
+    continue;
+  }
+}
+
+namespace __cxxabiv1 {
+std::terminate_handler __terminate_handler = my_terminate;
+}
+#endif
@@ -22,8 +22,10 @@ required_conan_version = ">=2.0.6"
 class application(ConanFile):
     settings = "compiler", "build_type", "os", "arch"
     generators = "CMakeToolchain", "CMakeDeps", "VirtualBuildEnv"
-    options = {"platform": ["ANY"]}
-    default_options = {"platform": "unspecified"}
+    options = {"platform": ["ANY"], "exception_pool": [True, False],
+               "emergency_pool": ["ANY"]}
+    default_options = {"platform": "unspecified", "exception_pool": False,
+                       "emergency_pool": "libstdc++"}
 
     def build_requirements(self):
         self.tool_requires("cmake/3.27.1")
@@ -38,5 +40,8 @@ class application(ConanFile):
 
     def build(self):
         cmake = CMake(self)
-        cmake.configure()
+        cmake.configure(variables={
+            "EXCEPTION_POOL": bool(self.options.exception_pool),
+            "EXCEPTION_EMERGENCY_POOL": str(self.options.emergency_pool),
+        })
         cmake.build()
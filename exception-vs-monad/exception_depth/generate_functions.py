@@ -1,7 +1,18 @@
 # REGEX to find number of functions in disassembly
 # ^[0-9a-f]+ <fallible_function[0-9]+_group[0-9]+\(\)>:
+# and with --dispatch virtual
+# ^[0-9a-f]+ <fallible_function[0-9]+_group[0-9]+::driver_call\(\)>:
 
 import argparse
+import pathlib
+import sys
+import textwrap
+
+sys.path.insert(0, str(pathlib.Path(__file__).resolve().parents[1]))
+import split_sources  # noqa: E402
+
+# Objects with destructors in each frame that passes the error on
+MAX_OBJECTS = 16
 
 _FILE_HEADER = """
 // Copyright 2023 Google LLC
@@ -24,18 +35,28 @@ _FILE_HEADER = """
 #include <cstdlib>
 #include <exception>
 
-constexpr size_t error_size = 128;
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#else
+#define HARNESS_STATE
+#endif
+
+constexpr size_t error_size = @ERROR_SIZE@;
 constexpr bool check_bounds_in_constructor = true;
 constexpr bool check_bounds_in_class_function = true;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
 constexpr uint32_t depth_before_exception = 1000;
+#endif
 
 struct error_t
 {
   std::array<std::uint8_t, error_size> data;
 };
 
-volatile std::uint64_t enable_register;
-volatile std::uint64_t trigger_register;
+HARNESS_STATE volatile std::uint64_t enable_register;
+HARNESS_STATE volatile std::uint64_t trigger_register;
 
 class non_trivial_destructor
 {
@@ -48,7 +69,8 @@ public:
         throw error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } };
       }
     }
-    enable_register = enable_register | (1 << (p_channel % 64));
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
   }
 
   non_trivial_destructor(non_trivial_destructor&) = delete;
@@ -59,7 +81,8 @@ public:
 
   ~non_trivial_destructor()
   {
-    enable_register = enable_register & ~(1 << (m_channel % 64));
+    enable_register =
+      enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
   }
 
   void trigger()
@@ -69,7 +92,8 @@ public:
         throw error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } };
       }
     }
-    trigger_register = trigger_register | (1 << (m_channel % 64));
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
   }
 
 private:
@@ -82,7 +106,11 @@ int top_call()
   return return_error();
 }
 
+#if defined(HOST_BENCHMARK)
+int harness::call_top()
+#else
 int main()
+#endif
 {
   volatile int return_code = 0;
   try {
@@ -95,6 +123,7 @@ int main()
   return return_code;
 }
 
+#if !defined(HOST_BENCHMARK)
 extern "C"
 {
   void _exit([[maybe_unused]] int rc)
@@ -127,12 +156,26 @@ extern "C"
 namespace __cxxabiv1 {
 std::terminate_handler __terminate_handler = my_terminate;
 }
+#endif
 
 // =============================================================================
 // Add generated code below
 // =============================================================================
 """
 
+# Where the part after the shared declarations starts, to split the header
+# when writing several translation units
+_PROGRAM_START = "int return_error();\n"
+
+_HOST_HOOKS_FORMAT = """
+#if defined(HOST_BENCHMARK)
+// Fail in the last frame of group 0 so the error crosses every frame
+const std::uint32_t harness::failing_threshold = {max_depth};
+const harness::result_layout harness::layout =
+  harness::describe<error_t, decltype(top_call())>();
+#endif
+"""
+
 _RETURN_ERROR_FORMAT = """
 {forward_declarations}
 int return_error()
@@ -142,7 +185,7 @@ int return_error()
 }}
 """
 _RETURN_FORWARD_ENTRY = """int fallible_function0_group{group}();
-volatile int side_effect{group} = 0;
+HARNESS_STATE volatile int side_effect{group} = 0;
 """
 _RETURN_SUM = """side_effect{group}"""
 _RETURN_ERROR_FORMAT_ENTRY = """fallible_function0_group{group}();"""
@@ -151,64 +194,258 @@ _DEPTH_FUNCTION_FORMAT = """
 int fallible_function{next_depth}_group{group}();
 int fallible_function{depth}_group{group}()
 {{
-  auto result = non_trivial_destructor({depth} * {depth});
-  result.trigger();
-  auto result2 = non_trivial_destructor({depth} * {depth} * 2);
-  result2.trigger();
-  side_effect{group} = side_effect{group} +
+{objects}  side_effect{group} = side_effect{group} +
     fallible_function{next_depth}_group{group}();
   return side_effect{group};
 }}
 """
 
+# One object of a frame that passes the error on, named result, result2 and
+# so on. The last frame, which throws, keeps its own two objects.
+_OBJECT_FORMAT = """  auto {name} = {type}({depth});
+  {name}.trigger();
+"""
+
 _LAST_DEPTH_FUNCTION_FORMAT = """
 int fallible_function{depth}_group{group}()
 {{
-  auto result = non_trivial_destructor({group} * {depth});
+  auto result = non_trivial_destructor({depth});
   result.trigger();
-  auto result2 = non_trivial_destructor({group} * {depth});
+  auto result2 = non_trivial_destructor({depth});
   result2.trigger();
   return side_effect{group} + 1;
 }}
 """
 
 
-def do_the_thing(max_groups: int, max_depth: int):
+# Does the same work as non_trivial_destructor but leaves nothing to undo, so
+# frames that only hold these have nothing to clean up
+_TRIVIAL_CLASS = """class trivial_destructor
+{
+public:
+  trivial_destructor(uint32_t p_channel)
+    : m_channel(p_channel)
+  {
+    if constexpr (check_bounds_in_constructor) {
+      if (p_channel >= depth_before_exception) {
+        throw error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } };
+      }
+    }
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
+  }
+
+  void trigger()
+  {
+    if constexpr (check_bounds_in_class_function) {
+      if (m_channel >= depth_before_exception) {
+        throw error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } };
+      }
+    }
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
+  }
+
+private:
+  uint32_t m_channel = 0;
+};
+
+"""
+
+# With --dispatch virtual every frame is a driver behind an interface, like
+# the libhal drivers, and calls the next frame through that interface
+_DRIVER_INTERFACE = """\
+// Shaped like a libhal interface: the public function forwards to a private
+// virtual driver_*() function that every driver implements
+class fallible_driver
+{
+public:
+  int call()
+  {
+    return driver_call();
+  }
+
+  virtual ~fallible_driver() = default;
+
+private:
+  virtual int driver_call() = 0;
+};
+
+"""
+
+_VIRTUAL_RETURN_FORWARD_ENTRY = """extern fallible_driver& driver0_group{group};
+HARNESS_STATE volatile int side_effect{group} = 0;
+"""
+_VIRTUAL_RETURN_ERROR_FORMAT_ENTRY = """driver0_group{group}.call();"""
+
+_VIRTUAL_DEPTH_FUNCTION_FORMAT = """
+extern fallible_driver& driver{next_depth}_group{group};
+
+class fallible_function{depth}_group{group} final : public fallible_driver
+{{
+public:
+  fallible_function{depth}_group{group}(fallible_driver& p_next)
+    : m_next(&p_next)
+  {{
+  }}
+
+private:
+  int driver_call() override
+  {{
+{objects}    side_effect{group} = side_effect{group} + m_next->call();
+    return side_effect{group};
+  }}
+
+  fallible_driver* m_next;
+}};
+
+static fallible_function{depth}_group{group} instance{depth}_group{group}(
+  driver{next_depth}_group{group});
+fallible_driver& driver{depth}_group{group} = instance{depth}_group{group};
+"""
+
+_VIRTUAL_LAST_DEPTH_FUNCTION_FORMAT = """
+class fallible_function{depth}_group{group} final : public fallible_driver
+{{
+private:
+  int driver_call() override
+  {{
+    auto result = non_trivial_destructor({depth});
+    result.trigger();
+    auto result2 = non_trivial_destructor({depth});
+    result2.trigger();
+    return side_effect{group} + 1;
+  }}
+}};
+
+static fallible_function{depth}_group{group} instance{depth}_group{group};
+fallible_driver& driver{depth}_group{group} = instance{depth}_group{group};
+"""
+
+# How each frame calls the next: the return_error() forward declarations, the
+# calls in return_error() and the frame formats
+_DISPATCHES = {
+    "direct": (_RETURN_FORWARD_ENTRY, _RETURN_ERROR_FORMAT_ENTRY,
+               _DEPTH_FUNCTION_FORMAT, _LAST_DEPTH_FUNCTION_FORMAT),
+    "virtual": (_VIRTUAL_RETURN_FORWARD_ENTRY,
+                _VIRTUAL_RETURN_ERROR_FORMAT_ENTRY,
+                _VIRTUAL_DEPTH_FUNCTION_FORMAT,
+                _VIRTUAL_LAST_DEPTH_FUNCTION_FORMAT),
+}
+
+
+def error_size(text: str) -> int:
+    """error_t is initialized with 4 bytes, so it cannot be any smaller"""
+    size = int(text)
+    if size < 4:
+        raise argparse.ArgumentTypeError(f"{size} is smaller than 4 bytes")
+    return size
+
+
+def object_count(text: str) -> int:
+    count = int(text)
+    if not 0 <= count <= MAX_OBJECTS:
+        raise argparse.ArgumentTypeError(
+            f"{count} is not between 0 and {MAX_OBJECTS}")
+    return count
+
+
+def frame_objects(count: int, type: str, depth: int) -> str:
+    """The objects of one frame that passes the error on"""
+    names = ["result", *(f"result{index}" for index in range(2, count + 1))]
+    return "".join(_OBJECT_FORMAT.format(name=name, type=type, depth=depth)
+                   for name in names[:count])
+
+
+def do_the_thing(max_groups: int, max_depth: int, error_size: int = 128,
+                 translation_units: int = 1, output_directory: str = None,
+                 dispatch: str = "direct", objects: int = 2,
+                 trivial_objects: bool = False):
+    (forward_entry, return_error_entry, depth_function_format,
+     last_depth_function_format) = _DISPATCHES[dispatch]
     return_error_function_calls = []
     forwards = []
     sums = []
     for group in range(max_groups):
-        forwards.append(_RETURN_FORWARD_ENTRY.format(group=group))
+        forwards.append(forward_entry.format(group=group))
         return_error_function_calls.append(
-            _RETURN_ERROR_FORMAT_ENTRY.format(group=group))
+            return_error_entry.format(group=group))
         sums.append(_RETURN_SUM.format(group=group))
 
     sums_string = "+".join(sums)
     forward_string = "\n".join(forwards)
     call_string = "\n".join(return_error_function_calls)
-    full_return_error_str = _RETURN_ERROR_FORMAT.format(
-        forward_declarations=forward_string,
-        usages=call_string,
-        sum=sums_string)
 
-    print(_FILE_HEADER)
-    print(full_return_error_str)
-
-    list_of_functions_and_groups = []
+    # Frame d of every group goes to unit d % translation_units, so with
+    # more than one unit every call down a chain crosses into another unit
+    functions_per_unit = [[] for _ in range(translation_units)]
 
+    object_type = ("trivial_destructor" if trivial_objects
+                   else "non_trivial_destructor")
     for group in range(max_groups):
         for depth in range(max_depth):
-            list_of_functions_and_groups.append(_DEPTH_FUNCTION_FORMAT.format(
-                next_group=group + 1,
-                next_depth=depth + 1,
-                group=group,
-                depth=depth,
-            ))
-        list_of_functions_and_groups.append(_LAST_DEPTH_FUNCTION_FORMAT.format(
-            depth=max_depth,
-            group=group))
-
-    print("".join(list_of_functions_and_groups))
+            object_code = frame_objects(objects, object_type, depth)
+            if dispatch == "virtual":
+                object_code = textwrap.indent(object_code, "  ")
+            functions_per_unit[depth % translation_units].append(
+                depth_function_format.format(
+                    next_group=group + 1,
+                    next_depth=depth + 1,
+                    group=group,
+                    depth=depth,
+                    objects=object_code,
+                ))
+        functions_per_unit[max_depth % translation_units].append(
+            last_depth_function_format.format(
+                depth=max_depth,
+                group=group))
+
+    header = _FILE_HEADER.replace("@ERROR_SIZE@", str(error_size))
+    if trivial_objects:
+        header = header.replace(_PROGRAM_START,
+                                _TRIVIAL_CLASS + _PROGRAM_START)
+    if dispatch == "virtual":
+        header = header.replace(_PROGRAM_START,
+                                _DRIVER_INTERFACE + _PROGRAM_START)
+    hooks = _HOST_HOOKS_FORMAT.format(max_depth=max_depth)
+    if translation_units == 1:
+        program = "\n".join([
+            header,
+            hooks,
+            _RETURN_ERROR_FORMAT.format(forward_declarations=forward_string,
+                                        usages=call_string,
+                                        sum=sums_string),
+            "".join(functions_per_unit[0]),
+        ])
+        if output_directory is None:
+            print(program)
+        else:
+            split_sources.write_units(output_directory,
+                                      [("main.cpp", program)])
+        return
+
+    license, declarations, program = split_sources.split_header(
+        header, _PROGRAM_START)
+    include = license + '\n#include "common.hpp"\n'
+    units = [
+        ("common.hpp", "\n".join([
+            license + "\n#pragma once",
+            split_sources.shareable(declarations),
+            split_sources.shareable(forward_string),
+        ])),
+        ("main.cpp", "\n".join([
+            include + program,
+            hooks,
+            _RETURN_ERROR_FORMAT.format(forward_declarations="",
+                                        usages=call_string,
+                                        sum=sums_string),
+            "".join(functions_per_unit[0]),
+        ])),
+    ]
+    units += [(f"unit{unit}.cpp", include + "".join(functions))
+              for unit, functions in enumerate(functions_per_unit)
+              if unit > 0]
+    split_sources.write_units(output_directory, units)
 
 
 if __name__ == "__main__":
@@ -217,5 +454,29 @@ if __name__ == "__main__":
                         help="Number of groups", default=10, type=int)
     parser.add_argument("-d", "--max_depth",
                         help="Max depth of functions", default=50, type=int)
+    parser.add_argument("-e", "--error_size", type=error_size, default=128,
+                        help="Bytes in error_t, at least 4")
+    parser.add_argument("--dispatch", default="direct",
+                        choices=list(_DISPATCHES),
+                        help="Call the next frame directly or through a "
+                        "virtual driver interface")
+    parser.add_argument("--objects", type=object_count, default=2,
+                        help="Objects in each frame that passes the error "
+                        f"on, 0 to {MAX_OBJECTS}")
+    parser.add_argument("--trivial_objects", action="store_true",
+                        help="Give those objects no destructor, as a "
+                        "control")
+    parser.add_argument("-u", "--translation_units", default=1, type=int,
+                        help="Source files to spread the frames over")
+    parser.add_argument("-o", "--output_directory",
+                        help="Write main.cpp (and with more than one unit, "
+                        "common.hpp and unitN.cpp) here instead of stdout")
     args = parser.parse_args()
-    do_the_thing(max_depth=args.max_depth, max_groups=args.max_groups)
+    if args.translation_units > 1 and args.output_directory is None:
+        parser.error("--translation_units needs --output_directory")
+    do_the_thing(max_depth=args.max_depth, max_groups=args.max_groups,
+                 error_size=args.error_size,
+                 translation_units=args.translation_units,
+                 output_directory=args.output_directory,
+                 dispatch=args.dispatch, objects=args.objects,
+                 trivial_objects=args.trivial_objects)
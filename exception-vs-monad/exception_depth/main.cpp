@@ -19,18 +19,28 @@
 #include <cstdlib>
 #include <exception>
 
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#else
+#define HARNESS_STATE
+#endif
+
 constexpr size_t error_size = 128;
 constexpr bool check_bounds_in_constructor = true;
 constexpr bool check_bounds_in_class_function = true;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
 constexpr uint32_t depth_before_exception = 1000;
+#endif
 
 struct error_t
 {
   std::array<std::uint8_t, error_size> data;
 };
 
-volatile std::uint64_t enable_register;
-volatile std::uint64_t trigger_register;
+HARNESS_STATE volatile std::uint64_t enable_register;
+HARNESS_STATE volatile std::uint64_t trigger_register;
 
 class non_trivial_destructor
 {
@@ -43,7 +53,8 @@ public:
         throw error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } };
       }
     }
-    enable_register = enable_register | (1 << (p_channel % 64));
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
   }
 
   non_trivial_destructor(non_trivial_destructor&) = delete;
@@ -54,7 +65,8 @@ public:
 
   ~non_trivial_destructor()
   {
-    enable_register = enable_register & ~(1 << (m_channel % 64));
+    enable_register =
+      enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
   }
 
   void trigger()
@@ -64,7 +76,8 @@ public:
         throw error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } };
       }
     }
-    trigger_register = trigger_register | (1 << (m_channel % 64));
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
   }
 
 private:
@@ -77,7 +90,11 @@ int top_call()
   return return_error();
 }
 
+#if defined(HOST_BENCHMARK)
+int harness::call_top()
+#else
 int main()
+#endif
 {
   volatile int return_code = 0;
   try {
@@ -90,6 +107,7 @@ int main()
   return return_code;
 }
 
+#if !defined(HOST_BENCHMARK)
 extern "C"
 {
   void _exit([[maybe_unused]] int rc)
@@ -122,41 +140,50 @@ extern "C"
 namespace __cxxabiv1 {
 std::terminate_handler __terminate_handler = my_terminate;
 }
+#endif
 
 // =============================================================================
 // Add generated code below
 // =============================================================================
 
 
+#if defined(HOST_BENCHMARK)
+// Fail in the last frame of group 0 so the error crosses every frame
+const std::uint32_t harness::failing_threshold = 15;
+const harness::result_layout harness::layout =
+  harness::describe<error_t, decltype(top_call())>();
+#endif
+
+
 int fallible_function0_group0();
-volatile int side_effect0 = 0;
+HARNESS_STATE volatile int side_effect0 = 0;
 
 int fallible_function0_group1();
-volatile int side_effect1 = 0;
+HARNESS_STATE volatile int side_effect1 = 0;
 
 int fallible_function0_group2();
-volatile int side_effect2 = 0;
+HARNESS_STATE volatile int side_effect2 = 0;
 
 int fallible_function0_group3();
-volatile int side_effect3 = 0;
+HARNESS_STATE volatile int side_effect3 = 0;
 
 int fallible_function0_group4();
-volatile int side_effect4 = 0;
+HARNESS_STATE volatile int side_effect4 = 0;
 
 int fallible_function0_group5();
-volatile int side_effect5 = 0;
+HARNESS_STATE volatile int side_effect5 = 0;
 
 int fallible_function0_group6();
-volatile int side_effect6 = 0;
+HARNESS_STATE volatile int side_effect6 = 0;
 
 int fallible_function0_group7();
-volatile int side_effect7 = 0;
+HARNESS_STATE volatile int side_effect7 = 0;
 
 int fallible_function0_group8();
-volatile int side_effect8 = 0;
+HARNESS_STATE volatile int side_effect8 = 0;
 
 int fallible_function0_group9();
-volatile int side_effect9 = 0;
+HARNESS_STATE volatile int side_effect9 = 0;
 
 int return_error()
 {
@@ -177,9 +204,9 @@ fallible_function0_group9();
 int fallible_function1_group0();
 int fallible_function0_group0()
 {
-  auto result = non_trivial_destructor(0 * 0);
+  auto result = non_trivial_destructor(0);
   result.trigger();
-  auto result2 = non_trivial_destructor(0 * 0 * 2);
+  auto result2 = non_trivial_destructor(0);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function1_group0();
@@ -189,9 +216,9 @@ int fallible_function0_group0()
 int fallible_function2_group0();
 int fallible_function1_group0()
 {
-  auto result = non_trivial_destructor(1 * 1);
+  auto result = non_trivial_destructor(1);
   result.trigger();
-  auto result2 = non_trivial_destructor(1 * 1 * 2);
+  auto result2 = non_trivial_destructor(1);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function2_group0();
@@ -201,9 +228,9 @@ int fallible_function1_group0()
 int fallible_function3_group0();
 int fallible_function2_group0()
 {
-  auto result = non_trivial_destructor(2 * 2);
+  auto result = non_trivial_destructor(2);
   result.trigger();
-  auto result2 = non_trivial_destructor(2 * 2 * 2);
+  auto result2 = non_trivial_destructor(2);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function3_group0();
@@ -213,9 +240,9 @@ int fallible_function2_group0()
 int fallible_function4_group0();
 int fallible_function3_group0()
 {
-  auto result = non_trivial_destructor(3 * 3);
+  auto result = non_trivial_destructor(3);
   result.trigger();
-  auto result2 = non_trivial_destructor(3 * 3 * 2);
+  auto result2 = non_trivial_destructor(3);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function4_group0();
@@ -225,9 +252,9 @@ int fallible_function3_group0()
 int fallible_function5_group0();
 int fallible_function4_group0()
 {
-  auto result = non_trivial_destructor(4 * 4);
+  auto result = non_trivial_destructor(4);
   result.trigger();
-  auto result2 = non_trivial_destructor(4 * 4 * 2);
+  auto result2 = non_trivial_destructor(4);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function5_group0();
@@ -237,9 +264,9 @@ int fallible_function4_group0()
 int fallible_function6_group0();
 int fallible_function5_group0()
 {
-  auto result = non_trivial_destructor(5 * 5);
+  auto result = non_trivial_destructor(5);
   result.trigger();
-  auto result2 = non_trivial_destructor(5 * 5 * 2);
+  auto result2 = non_trivial_destructor(5);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function6_group0();
@@ -249,9 +276,9 @@ int fallible_function5_group0()
 int fallible_function7_group0();
 int fallible_function6_group0()
 {
-  auto result = non_trivial_destructor(6 * 6);
+  auto result = non_trivial_destructor(6);
   result.trigger();
-  auto result2 = non_trivial_destructor(6 * 6 * 2);
+  auto result2 = non_trivial_destructor(6);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function7_group0();
@@ -261,9 +288,9 @@ int fallible_function6_group0()
 int fallible_function8_group0();
 int fallible_function7_group0()
 {
-  auto result = non_trivial_destructor(7 * 7);
+  auto result = non_trivial_destructor(7);
   result.trigger();
-  auto result2 = non_trivial_destructor(7 * 7 * 2);
+  auto result2 = non_trivial_destructor(7);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function8_group0();
@@ -273,9 +300,9 @@ int fallible_function7_group0()
 int fallible_function9_group0();
 int fallible_function8_group0()
 {
-  auto result = non_trivial_destructor(8 * 8);
+  auto result = non_trivial_destructor(8);
   result.trigger();
-  auto result2 = non_trivial_destructor(8 * 8 * 2);
+  auto result2 = non_trivial_destructor(8);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function9_group0();
@@ -285,9 +312,9 @@ int fallible_function8_group0()
 int fallible_function10_group0();
 int fallible_function9_group0()
 {
-  auto result = non_trivial_destructor(9 * 9);
+  auto result = non_trivial_destructor(9);
   result.trigger();
-  auto result2 = non_trivial_destructor(9 * 9 * 2);
+  auto result2 = non_trivial_destructor(9);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function10_group0();
@@ -297,9 +324,9 @@ int fallible_function9_group0()
 int fallible_function11_group0();
 int fallible_function10_group0()
 {
-  auto result = non_trivial_destructor(10 * 10);
+  auto result = non_trivial_destructor(10);
   result.trigger();
-  auto result2 = non_trivial_destructor(10 * 10 * 2);
+  auto result2 = non_trivial_destructor(10);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function11_group0();
@@ -309,9 +336,9 @@ int fallible_function10_group0()
 int fallible_function12_group0();
 int fallible_function11_group0()
 {
-  auto result = non_trivial_destructor(11 * 11);
+  auto result = non_trivial_destructor(11);
   result.trigger();
-  auto result2 = non_trivial_destructor(11 * 11 * 2);
+  auto result2 = non_trivial_destructor(11);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function12_group0();
@@ -321,9 +348,9 @@ int fallible_function11_group0()
 int fallible_function13_group0();
 int fallible_function12_group0()
 {
-  auto result = non_trivial_destructor(12 * 12);
+  auto result = non_trivial_destructor(12);
   result.trigger();
-  auto result2 = non_trivial_destructor(12 * 12 * 2);
+  auto result2 = non_trivial_destructor(12);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function13_group0();
@@ -333,9 +360,9 @@ int fallible_function12_group0()
 int fallible_function14_group0();
 int fallible_function13_group0()
 {
-  auto result = non_trivial_destructor(13 * 13);
+  auto result = non_trivial_destructor(13);
   result.trigger();
-  auto result2 = non_trivial_destructor(13 * 13 * 2);
+  auto result2 = non_trivial_destructor(13);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function14_group0();
@@ -345,9 +372,9 @@ int fallible_function13_group0()
 int fallible_function15_group0();
 int fallible_function14_group0()
 {
-  auto result = non_trivial_destructor(14 * 14);
+  auto result = non_trivial_destructor(14);
   result.trigger();
-  auto result2 = non_trivial_destructor(14 * 14 * 2);
+  auto result2 = non_trivial_destructor(14);
   result2.trigger();
   side_effect0 = side_effect0 +
     fallible_function15_group0();
@@ -356,9 +383,9 @@ int fallible_function14_group0()
 
 int fallible_function15_group0()
 {
-  auto result = non_trivial_destructor(0 * 15);
+  auto result = non_trivial_destructor(15);
   result.trigger();
-  auto result2 = non_trivial_destructor(0 * 15);
+  auto result2 = non_trivial_destructor(15);
   result2.trigger();
   return side_effect0 + 1;
 }
@@ -366,9 +393,9 @@ int fallible_function15_group0()
 int fallible_function1_group1();
 int fallible_function0_group1()
 {
-  auto result = non_trivial_destructor(0 * 0);
+  auto result = non_trivial_destructor(0);
   result.trigger();
-  auto result2 = non_trivial_destructor(0 * 0 * 2);
+  auto result2 = non_trivial_destructor(0);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function1_group1();
@@ -378,9 +405,9 @@ int fallible_function0_group1()
 int fallible_function2_group1();
 int fallible_function1_group1()
 {
-  auto result = non_trivial_destructor(1 * 1);
+  auto result = non_trivial_destructor(1);
   result.trigger();
-  auto result2 = non_trivial_destructor(1 * 1 * 2);
+  auto result2 = non_trivial_destructor(1);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function2_group1();
@@ -390,9 +417,9 @@ int fallible_function1_group1()
 int fallible_function3_group1();
 int fallible_function2_group1()
 {
-  auto result = non_trivial_destructor(2 * 2);
+  auto result = non_trivial_destructor(2);
   result.trigger();
-  auto result2 = non_trivial_destructor(2 * 2 * 2);
+  auto result2 = non_trivial_destructor(2);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function3_group1();
@@ -402,9 +429,9 @@ int fallible_function2_group1()
 int fallible_function4_group1();
 int fallible_function3_group1()
 {
-  auto result = non_trivial_destructor(3 * 3);
+  auto result = non_trivial_destructor(3);
   result.trigger();
-  auto result2 = non_trivial_destructor(3 * 3 * 2);
+  auto result2 = non_trivial_destructor(3);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function4_group1();
@@ -414,9 +441,9 @@ int fallible_function3_group1()
 int fallible_function5_group1();
 int fallible_function4_group1()
 {
-  auto result = non_trivial_destructor(4 * 4);
+  auto result = non_trivial_destructor(4);
   result.trigger();
-  auto result2 = non_trivial_destructor(4 * 4 * 2);
+  auto result2 = non_trivial_destructor(4);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function5_group1();
@@ -426,9 +453,9 @@ int fallible_function4_group1()
 int fallible_function6_group1();
 int fallible_function5_group1()
 {
-  auto result = non_trivial_destructor(5 * 5);
+  auto result = non_trivial_destructor(5);
   result.trigger();
-  auto result2 = non_trivial_destructor(5 * 5 * 2);
+  auto result2 = non_trivial_destructor(5);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function6_group1();
@@ -438,9 +465,9 @@ int fallible_function5_group1()
 int fallible_function7_group1();
 int fallible_function6_group1()
 {
-  auto result = non_trivial_destructor(6 * 6);
+  auto result = non_trivial_destructor(6);
   result.trigger();
-  auto result2 = non_trivial_destructor(6 * 6 * 2);
+  auto result2 = non_trivial_destructor(6);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function7_group1();
@@ -450,9 +477,9 @@ int fallible_function6_group1()
 int fallible_function8_group1();
 int fallible_function7_group1()
 {
-  auto result = non_trivial_destructor(7 * 7);
+  auto result = non_trivial_destructor(7);
   result.trigger();
-  auto result2 = non_trivial_destructor(7 * 7 * 2);
+  auto result2 = non_trivial_destructor(7);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function8_group1();
@@ -462,9 +489,9 @@ int fallible_function7_group1()
 int fallible_function9_group1();
 int fallible_function8_group1()
 {
-  auto result = non_trivial_destructor(8 * 8);
+  auto result = non_trivial_destructor(8);
   result.trigger();
-  auto result2 = non_trivial_destructor(8 * 8 * 2);
+  auto result2 = non_trivial_destructor(8);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function9_group1();
@@ -474,9 +501,9 @@ int fallible_function8_group1()
 int fallible_function10_group1();
 int fallible_function9_group1()
 {
-  auto result = non_trivial_destructor(9 * 9);
+  auto result = non_trivial_destructor(9);
   result.trigger();
-  auto result2 = non_trivial_destructor(9 * 9 * 2);
+  auto result2 = non_trivial_destructor(9);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function10_group1();
@@ -486,9 +513,9 @@ int fallible_function9_group1()
 int fallible_function11_group1();
 int fallible_function10_group1()
 {
-  auto result = non_trivial_destructor(10 * 10);
+  auto result = non_trivial_destructor(10);
   result.trigger();
-  auto result2 = non_trivial_destructor(10 * 10 * 2);
+  auto result2 = non_trivial_destructor(10);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function11_group1();
@@ -498,9 +525,9 @@ int fallible_function10_group1()
 int fallible_function12_group1();
 int fallible_function11_group1()
 {
-  auto result = non_trivial_destructor(11 * 11);
+  auto result = non_trivial_destructor(11);
   result.trigger();
-  auto result2 = non_trivial_destructor(11 * 11 * 2);
+  auto result2 = non_trivial_destructor(11);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function12_group1();
@@ -510,9 +537,9 @@ int fallible_function11_group1()
 int fallible_function13_group1();
 int fallible_function12_group1()
 {
-  auto result = non_trivial_destructor(12 * 12);
+  auto result = non_trivial_destructor(12);
   result.trigger();
-  auto result2 = non_trivial_destructor(12 * 12 * 2);
+  auto result2 = non_trivial_destructor(12);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function13_group1();
@@ -522,9 +549,9 @@ int fallible_function12_group1()
 int fallible_function14_group1();
 int fallible_function13_group1()
 {
-  auto result = non_trivial_destructor(13 * 13);
+  auto result = non_trivial_destructor(13);
   result.trigger();
-  auto result2 = non_trivial_destructor(13 * 13 * 2);
+  auto result2 = non_trivial_destructor(13);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function14_group1();
@@ -534,9 +561,9 @@ int fallible_function13_group1()
 int fallible_function15_group1();
 int fallible_function14_group1()
 {
-  auto result = non_trivial_destructor(14 * 14);
+  auto result = non_trivial_destructor(14);
   result.trigger();
-  auto result2 = non_trivial_destructor(14 * 14 * 2);
+  auto result2 = non_trivial_destructor(14);
   result2.trigger();
   side_effect1 = side_effect1 +
     fallible_function15_group1();
@@ -545,9 +572,9 @@ int fallible_function14_group1()
 
 int fallible_function15_group1()
 {
-  auto result = non_trivial_destructor(1 * 15);
+  auto result = non_trivial_destructor(15);
   result.trigger();
-  auto result2 = non_trivial_destructor(1 * 15);
+  auto result2 = non_trivial_destructor(15);
   result2.trigger();
   return side_effect1 + 1;
 }
@@ -555,9 +582,9 @@ int fallible_function15_group1()
 int fallible_function1_group2();
 int fallible_function0_group2()
 {
-  auto result = non_trivial_destructor(0 * 0);
+  auto result = non_trivial_destructor(0);
   result.trigger();
-  auto result2 = non_trivial_destructor(0 * 0 * 2);
+  auto result2 = non_trivial_destructor(0);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function1_group2();
@@ -567,9 +594,9 @@ int fallible_function0_group2()
 int fallible_function2_group2();
 int fallible_function1_group2()
 {
-  auto result = non_trivial_destructor(1 * 1);
+  auto result = non_trivial_destructor(1);
   result.trigger();
-  auto result2 = non_trivial_destructor(1 * 1 * 2);
+  auto result2 = non_trivial_destructor(1);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function2_group2();
@@ -579,9 +606,9 @@ int fallible_function1_group2()
 int fallible_function3_group2();
 int fallible_function2_group2()
 {
-  auto result = non_trivial_destructor(2 * 2);
+  auto result = non_trivial_destructor(2);
   result.trigger();
-  auto result2 = non_trivial_destructor(2 * 2 * 2);
+  auto result2 = non_trivial_destructor(2);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function3_group2();
@@ -591,9 +618,9 @@ int fallible_function2_group2()
 int fallible_function4_group2();
 int fallible_function3_group2()
 {
-  auto result = non_trivial_destructor(3 * 3);
+  auto result = non_trivial_destructor(3);
   result.trigger();
-  auto result2 = non_trivial_destructor(3 * 3 * 2);
+  auto result2 = non_trivial_destructor(3);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function4_group2();
@@ -603,9 +630,9 @@ int fallible_function3_group2()
 int fallible_function5_group2();
 int fallible_function4_group2()
 {
-  auto result = non_trivial_destructor(4 * 4);
+  auto result = non_trivial_destructor(4);
   result.trigger();
-  auto result2 = non_trivial_destructor(4 * 4 * 2);
+  auto result2 = non_trivial_destructor(4);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function5_group2();
@@ -615,9 +642,9 @@ int fallible_function4_group2()
 int fallible_function6_group2();
 int fallible_function5_group2()
 {
-  auto result = non_trivial_destructor(5 * 5);
+  auto result = non_trivial_destructor(5);
   result.trigger();
-  auto result2 = non_trivial_destructor(5 * 5 * 2);
+  auto result2 = non_trivial_destructor(5);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function6_group2();
@@ -627,9 +654,9 @@ int fallible_function5_group2()
 int fallible_function7_group2();
 int fallible_function6_group2()
 {
-  auto result = non_trivial_destructor(6 * 6);
+  auto result = non_trivial_destructor(6);
   result.trigger();
-  auto result2 = non_trivial_destructor(6 * 6 * 2);
+  auto result2 = non_trivial_destructor(6);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function7_group2();
@@ -639,9 +666,9 @@ int fallible_function6_group2()
 int fallible_function8_group2();
 int fallible_function7_group2()
 {
-  auto result = non_trivial_destructor(7 * 7);
+  auto result = non_trivial_destructor(7);
   result.trigger();
-  auto result2 = non_trivial_destructor(7 * 7 * 2);
+  auto result2 = non_trivial_destructor(7);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function8_group2();
@@ -651,9 +678,9 @@ int fallible_function7_group2()
 int fallible_function9_group2();
 int fallible_function8_group2()
 {
-  auto result = non_trivial_destructor(8 * 8);
+  auto result = non_trivial_destructor(8);
   result.trigger();
-  auto result2 = non_trivial_destructor(8 * 8 * 2);
+  auto result2 = non_trivial_destructor(8);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function9_group2();
@@ -663,9 +690,9 @@ int fallible_function8_group2()
 int fallible_function10_group2();
 int fallible_function9_group2()
 {
-  auto result = non_trivial_destructor(9 * 9);
+  auto result = non_trivial_destructor(9);
   result.trigger();
-  auto result2 = non_trivial_destructor(9 * 9 * 2);
+  auto result2 = non_trivial_destructor(9);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function10_group2();
@@ -675,9 +702,9 @@ int fallible_function9_group2()
 int fallible_function11_group2();
 int fallible_function10_group2()
 {
-  auto result = non_trivial_destructor(10 * 10);
+  auto result = non_trivial_destructor(10);
   result.trigger();
-  auto result2 = non_trivial_destructor(10 * 10 * 2);
+  auto result2 = non_trivial_destructor(10);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function11_group2();
@@ -687,9 +714,9 @@ int fallible_function10_group2()
 int fallible_function12_group2();
 int fallible_function11_group2()
 {
-  auto result = non_trivial_destructor(11 * 11);
+  auto result = non_trivial_destructor(11);
   result.trigger();
-  auto result2 = non_trivial_destructor(11 * 11 * 2);
+  auto result2 = non_trivial_destructor(11);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function12_group2();
@@ -699,9 +726,9 @@ int fallible_function11_group2()
 int fallible_function13_group2();
 int fallible_function12_group2()
 {
-  auto result = non_trivial_destructor(12 * 12);
+  auto result = non_trivial_destructor(12);
   result.trigger();
-  auto result2 = non_trivial_destructor(12 * 12 * 2);
+  auto result2 = non_trivial_destructor(12);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function13_group2();
@@ -711,9 +738,9 @@ int fallible_function12_group2()
 int fallible_function14_group2();
 int fallible_function13_group2()
 {
-  auto result = non_trivial_destructor(13 * 13);
+  auto result = non_trivial_destructor(13);
   result.trigger();
-  auto result2 = non_trivial_destructor(13 * 13 * 2);
+  auto result2 = non_trivial_destructor(13);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function14_group2();
@@ -723,9 +750,9 @@ int fallible_function13_group2()
 int fallible_function15_group2();
 int fallible_function14_group2()
 {
-  auto result = non_trivial_destructor(14 * 14);
+  auto result = non_trivial_destructor(14);
   result.trigger();
-  auto result2 = non_trivial_destructor(14 * 14 * 2);
+  auto result2 = non_trivial_destructor(14);
   result2.trigger();
   side_effect2 = side_effect2 +
     fallible_function15_group2();
@@ -734,9 +761,9 @@ int fallible_function14_group2()
 
 int fallible_function15_group2()
 {
-  auto result = non_trivial_destructor(2 * 15);
+  auto result = non_trivial_destructor(15);
   result.trigger();
-  auto result2 = non_trivial_destructor(2 * 15);
+  auto result2 = non_trivial_destructor(15);
   result2.trigger();
   return side_effect2 + 1;
 }
@@ -744,9 +771,9 @@ int fallible_function15_group2()
 int fallible_function1_group3();
 int fallible_function0_group3()
 {
-  auto result = non_trivial_destructor(0 * 0);
+  auto result = non_trivial_destructor(0);
   result.trigger();
-  auto result2 = non_trivial_destructor(0 * 0 * 2);
+  auto result2 = non_trivial_destructor(0);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function1_group3();
@@ -756,9 +783,9 @@ int fallible_function0_group3()
 int fallible_function2_group3();
 int fallible_function1_group3()
 {
-  auto result = non_trivial_destructor(1 * 1);
+  auto result = non_trivial_destructor(1);
   result.trigger();
-  auto result2 = non_trivial_destructor(1 * 1 * 2);
+  auto result2 = non_trivial_destructor(1);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function2_group3();
@@ -768,9 +795,9 @@ int fallible_function1_group3()
 int fallible_function3_group3();
 int fallible_function2_group3()
 {
-  auto result = non_trivial_destructor(2 * 2);
+  auto result = non_trivial_destructor(2);
   result.trigger();
-  auto result2 = non_trivial_destructor(2 * 2 * 2);
+  auto result2 = non_trivial_destructor(2);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function3_group3();
@@ -780,9 +807,9 @@ int fallible_function2_group3()
 int fallible_function4_group3();
 int fallible_function3_group3()
 {
-  auto result = non_trivial_destructor(3 * 3);
+  auto result = non_trivial_destructor(3);
   result.trigger();
-  auto result2 = non_trivial_destructor(3 * 3 * 2);
+  auto result2 = non_trivial_destructor(3);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function4_group3();
@@ -792,9 +819,9 @@ int fallible_function3_group3()
 int fallible_function5_group3();
 int fallible_function4_group3()
 {
-  auto result = non_trivial_destructor(4 * 4);
+  auto result = non_trivial_destructor(4);
   result.trigger();
-  auto result2 = non_trivial_destructor(4 * 4 * 2);
+  auto result2 = non_trivial_destructor(4);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function5_group3();
@@ -804,9 +831,9 @@ int fallible_function4_group3()
 int fallible_function6_group3();
 int fallible_function5_group3()
 {
-  auto result = non_trivial_destructor(5 * 5);
+  auto result = non_trivial_destructor(5);
   result.trigger();
-  auto result2 = non_trivial_destructor(5 * 5 * 2);
+  auto result2 = non_trivial_destructor(5);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function6_group3();
@@ -816,9 +843,9 @@ int fallible_function5_group3()
 int fallible_function7_group3();
 int fallible_function6_group3()
 {
-  auto result = non_trivial_destructor(6 * 6);
+  auto result = non_trivial_destructor(6);
   result.trigger();
-  auto result2 = non_trivial_destructor(6 * 6 * 2);
+  auto result2 = non_trivial_destructor(6);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function7_group3();
@@ -828,9 +855,9 @@ int fallible_function6_group3()
 int fallible_function8_group3();
 int fallible_function7_group3()
 {
-  auto result = non_trivial_destructor(7 * 7);
+  auto result = non_trivial_destructor(7);
   result.trigger();
-  auto result2 = non_trivial_destructor(7 * 7 * 2);
+  auto result2 = non_trivial_destructor(7);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function8_group3();
@@ -840,9 +867,9 @@ int fallible_function7_group3()
 int fallible_function9_group3();
 int fallible_function8_group3()
 {
-  auto result = non_trivial_destructor(8 * 8);
+  auto result = non_trivial_destructor(8);
   result.trigger();
-  auto result2 = non_trivial_destructor(8 * 8 * 2);
+  auto result2 = non_trivial_destructor(8);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function9_group3();
@@ -852,9 +879,9 @@ int fallible_function8_group3()
 int fallible_function10_group3();
 int fallible_function9_group3()
 {
-  auto result = non_trivial_destructor(9 * 9);
+  auto result = non_trivial_destructor(9);
   result.trigger();
-  auto result2 = non_trivial_destructor(9 * 9 * 2);
+  auto result2 = non_trivial_destructor(9);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function10_group3();
@@ -864,9 +891,9 @@ int fallible_function9_group3()
 int fallible_function11_group3();
 int fallible_function10_group3()
 {
-  auto result = non_trivial_destructor(10 * 10);
+  auto result = non_trivial_destructor(10);
   result.trigger();
-  auto result2 = non_trivial_destructor(10 * 10 * 2);
+  auto result2 = non_trivial_destructor(10);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function11_group3();
@@ -876,9 +903,9 @@ int fallible_function10_group3()
 int fallible_function12_group3();
 int fallible_function11_group3()
 {
-  auto result = non_trivial_destructor(11 * 11);
+  auto result = non_trivial_destructor(11);
   result.trigger();
-  auto result2 = non_trivial_destructor(11 * 11 * 2);
+  auto result2 = non_trivial_destructor(11);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function12_group3();
@@ -888,9 +915,9 @@ int fallible_function11_group3()
 int fallible_function13_group3();
 int fallible_function12_group3()
 {
-  auto result = non_trivial_destructor(12 * 12);
+  auto result = non_trivial_destructor(12);
   result.trigger();
-  auto result2 = non_trivial_destructor(12 * 12 * 2);
+  auto result2 = non_trivial_destructor(12);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function13_group3();
@@ -900,9 +927,9 @@ int fallible_function12_group3()
 int fallible_function14_group3();
 int fallible_function13_group3()
 {
-  auto result = non_trivial_destructor(13 * 13);
+  auto result = non_trivial_destructor(13);
   result.trigger();
-  auto result2 = non_trivial_destructor(13 * 13 * 2);
+  auto result2 = non_trivial_destructor(13);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function14_group3();
@@ -912,9 +939,9 @@ int fallible_function13_group3()
 int fallible_function15_group3();
 int fallible_function14_group3()
 {
-  auto result = non_trivial_destructor(14 * 14);
+  auto result = non_trivial_destructor(14);
   result.trigger();
-  auto result2 = non_trivial_destructor(14 * 14 * 2);
+  auto result2 = non_trivial_destructor(14);
   result2.trigger();
   side_effect3 = side_effect3 +
     fallible_function15_group3();
@@ -923,9 +950,9 @@ int fallible_function14_group3()
 
 int fallible_function15_group3()
 {
-  auto result = non_trivial_destructor(3 * 15);
+  auto result = non_trivial_destructor(15);
   result.trigger();
-  auto result2 = non_trivial_destructor(3 * 15);
+  auto result2 = non_trivial_destructor(15);
   result2.trigger();
   return side_effect3 + 1;
 }
@@ -933,9 +960,9 @@ int fallible_function15_group3()
 int fallible_function1_group4();
 int fallible_function0_group4()
 {
-  auto result = non_trivial_destructor(0 * 0);
+  auto result = non_trivial_destructor(0);
   result.trigger();
-  auto result2 = non_trivial_destructor(0 * 0 * 2);
+  auto result2 = non_trivial_destructor(0);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function1_group4();
@@ -945,9 +972,9 @@ int fallible_function0_group4()
 int fallible_function2_group4();
 int fallible_function1_group4()
 {
-  auto result = non_trivial_destructor(1 * 1);
+  auto result = non_trivial_destructor(1);
   result.trigger();
-  auto result2 = non_trivial_destructor(1 * 1 * 2);
+  auto result2 = non_trivial_destructor(1);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function2_group4();
@@ -957,9 +984,9 @@ int fallible_function1_group4()
 int fallible_function3_group4();
 int fallible_function2_group4()
 {
-  auto result = non_trivial_destructor(2 * 2);
+  auto result = non_trivial_destructor(2);
   result.trigger();
-  auto result2 = non_trivial_destructor(2 * 2 * 2);
+  auto result2 = non_trivial_destructor(2);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function3_group4();
@@ -969,9 +996,9 @@ int fallible_function2_group4()
 int fallible_function4_group4();
 int fallible_function3_group4()
 {
-  auto result = non_trivial_destructor(3 * 3);
+  auto result = non_trivial_destructor(3);
   result.trigger();
-  auto result2 = non_trivial_destructor(3 * 3 * 2);
+  auto result2 = non_trivial_destructor(3);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function4_group4();
@@ -981,9 +1008,9 @@ int fallible_function3_group4()
 int fallible_function5_group4();
 int fallible_function4_group4()
 {
-  auto result = non_trivial_destructor(4 * 4);
+  auto result = non_trivial_destructor(4);
   result.trigger();
-  auto result2 = non_trivial_destructor(4 * 4 * 2);
+  auto result2 = non_trivial_destructor(4);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function5_group4();
@@ -993,9 +1020,9 @@ int fallible_function4_group4()
 int fallible_function6_group4();
 int fallible_function5_group4()
 {
-  auto result = non_trivial_destructor(5 * 5);
+  auto result = non_trivial_destructor(5);
   result.trigger();
-  auto result2 = non_trivial_destructor(5 * 5 * 2);
+  auto result2 = non_trivial_destructor(5);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function6_group4();
@@ -1005,9 +1032,9 @@ int fallible_function5_group4()
 int fallible_function7_group4();
 int fallible_function6_group4()
 {
-  auto result = non_trivial_destructor(6 * 6);
+  auto result = non_trivial_destructor(6);
   result.trigger();
-  auto result2 = non_trivial_destructor(6 * 6 * 2);
+  auto result2 = non_trivial_destructor(6);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function7_group4();
@@ -1017,9 +1044,9 @@ int fallible_function6_group4()
 int fallible_function8_group4();
 int fallible_function7_group4()
 {
-  auto result = non_trivial_destructor(7 * 7);
+  auto result = non_trivial_destructor(7);
   result.trigger();
-  auto result2 = non_trivial_destructor(7 * 7 * 2);
+  auto result2 = non_trivial_destructor(7);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function8_group4();
@@ -1029,9 +1056,9 @@ int fallible_function7_group4()
 int fallible_function9_group4();
 int fallible_function8_group4()
 {
-  auto result = non_trivial_destructor(8 * 8);
+  auto result = non_trivial_destructor(8);
   result.trigger();
-  auto result2 = non_trivial_destructor(8 * 8 * 2);
+  auto result2 = non_trivial_destructor(8);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function9_group4();
@@ -1041,9 +1068,9 @@ int fallible_function8_group4()
 int fallible_function10_group4();
 int fallible_function9_group4()
 {
-  auto result = non_trivial_destructor(9 * 9);
+  auto result = non_trivial_destructor(9);
   result.trigger();
-  auto result2 = non_trivial_destructor(9 * 9 * 2);
+  auto result2 = non_trivial_destructor(9);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function10_group4();
@@ -1053,9 +1080,9 @@ int fallible_function9_group4()
 int fallible_function11_group4();
 int fallible_function10_group4()
 {
-  auto result = non_trivial_destructor(10 * 10);
+  auto result = non_trivial_destructor(10);
   result.trigger();
-  auto result2 = non_trivial_destructor(10 * 10 * 2);
+  auto result2 = non_trivial_destructor(10);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function11_group4();
@@ -1065,9 +1092,9 @@ int fallible_function10_group4()
 int fallible_function12_group4();
 int fallible_function11_group4()
 {
-  auto result = non_trivial_destructor(11 * 11);
+  auto result = non_trivial_destructor(11);
   result.trigger();
-  auto result2 = non_trivial_destructor(11 * 11 * 2);
+  auto result2 = non_trivial_destructor(11);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function12_group4();
@@ -1077,9 +1104,9 @@ int fallible_function11_group4()
 int fallible_function13_group4();
 int fallible_function12_group4()
 {
-  auto result = non_trivial_destructor(12 * 12);
+  auto result = non_trivial_destructor(12);
   result.trigger();
-  auto result2 = non_trivial_destructor(12 * 12 * 2);
+  auto result2 = non_trivial_destructor(12);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function13_group4();
@@ -1089,9 +1116,9 @@ int fallible_function12_group4()
 int fallible_function14_group4();
 int fallible_function13_group4()
 {
-  auto result = non_trivial_destructor(13 * 13);
+  auto result = non_trivial_destructor(13);
   result.trigger();
-  auto result2 = non_trivial_destructor(13 * 13 * 2);
+  auto result2 = non_trivial_destructor(13);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function14_group4();
@@ -1101,9 +1128,9 @@ int fallible_function13_group4()
 int fallible_function15_group4();
 int fallible_function14_group4()
 {
-  auto result = non_trivial_destructor(14 * 14);
+  auto result = non_trivial_destructor(14);
   result.trigger();
-  auto result2 = non_trivial_destructor(14 * 14 * 2);
+  auto result2 = non_trivial_destructor(14);
   result2.trigger();
   side_effect4 = side_effect4 +
     fallible_function15_group4();
@@ -1112,9 +1139,9 @@ int fallible_function14_group4()
 
 int fallible_function15_group4()
 {
-  auto result = non_trivial_destructor(4 * 15);
+  auto result = non_trivial_destructor(15);
   result.trigger();
-  auto result2 = non_trivial_destructor(4 * 15);
+  auto result2 = non_trivial_destructor(15);
   result2.trigger();
   return side_effect4 + 1;
 }
@@ -1122,9 +1149,9 @@ int fallible_function15_group4()
 int fallible_function1_group5();
 int fallible_function0_group5()
 {
-  auto result = non_trivial_destructor(0 * 0);
+  auto result = non_trivial_destructor(0);
   result.trigger();
-  auto result2 = non_trivial_destructor(0 * 0 * 2);
+  auto result2 = non_trivial_destructor(0);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function1_group5();
@@ -1134,9 +1161,9 @@ int fallible_function0_group5()
 int fallible_function2_group5();
 int fallible_function1_group5()
 {
-  auto result = non_trivial_destructor(1 * 1);
+  auto result = non_trivial_destructor(1);
   result.trigger();
-  auto result2 = non_trivial_destructor(1 * 1 * 2);
+  auto result2 = non_trivial_destructor(1);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function2_group5();
@@ -1146,9 +1173,9 @@ int fallible_function1_group5()
 int fallible_function3_group5();
 int fallible_function2_group5()
 {
-  auto result = non_trivial_destructor(2 * 2);
+  auto result = non_trivial_destructor(2);
   result.trigger();
-  auto result2 = non_trivial_destructor(2 * 2 * 2);
+  auto result2 = non_trivial_destructor(2);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function3_group5();
@@ -1158,9 +1185,9 @@ int fallible_function2_group5()
 int fallible_function4_group5();
 int fallible_function3_group5()
 {
-  auto result = non_trivial_destructor(3 * 3);
+  auto result = non_trivial_destructor(3);
   result.trigger();
-  auto result2 = non_trivial_destructor(3 * 3 * 2);
+  auto result2 = non_trivial_destructor(3);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function4_group5();
@@ -1170,9 +1197,9 @@ int fallible_function3_group5()
 int fallible_function5_group5();
 int fallible_function4_group5()
 {
-  auto result = non_trivial_destructor(4 * 4);
+  auto result = non_trivial_destructor(4);
   result.trigger();
-  auto result2 = non_trivial_destructor(4 * 4 * 2);
+  auto result2 = non_trivial_destructor(4);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function5_group5();
@@ -1182,9 +1209,9 @@ int fallible_function4_group5()
 int fallible_function6_group5();
 int fallible_function5_group5()
 {
-  auto result = non_trivial_destructor(5 * 5);
+  auto result = non_trivial_destructor(5);
   result.trigger();
-  auto result2 = non_trivial_destructor(5 * 5 * 2);
+  auto result2 = non_trivial_destructor(5);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function6_group5();
@@ -1194,9 +1221,9 @@ int fallible_function5_group5()
 int fallible_function7_group5();
 int fallible_function6_group5()
 {
-  auto result = non_trivial_destructor(6 * 6);
+  auto result = non_trivial_destructor(6);
   result.trigger();
-  auto result2 = non_trivial_destructor(6 * 6 * 2);
+  auto result2 = non_trivial_destructor(6);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function7_group5();
@@ -1206,9 +1233,9 @@ int fallible_function6_group5()
 int fallible_function8_group5();
 int fallible_function7_group5()
 {
-  auto result = non_trivial_destructor(7 * 7);
+  auto result = non_trivial_destructor(7);
   result.trigger();
-  auto result2 = non_trivial_destructor(7 * 7 * 2);
+  auto result2 = non_trivial_destructor(7);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function8_group5();
@@ -1218,9 +1245,9 @@ int fallible_function7_group5()
 int fallible_function9_group5();
 int fallible_function8_group5()
 {
-  auto result = non_trivial_destructor(8 * 8);
+  auto result = non_trivial_destructor(8);
   result.trigger();
-  auto result2 = non_trivial_destructor(8 * 8 * 2);
+  auto result2 = non_trivial_destructor(8);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function9_group5();
@@ -1230,9 +1257,9 @@ int fallible_function8_group5()
 int fallible_function10_group5();
 int fallible_function9_group5()
 {
-  auto result = non_trivial_destructor(9 * 9);
+  auto result = non_trivial_destructor(9);
   result.trigger();
-  auto result2 = non_trivial_destructor(9 * 9 * 2);
+  auto result2 = non_trivial_destructor(9);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function10_group5();
@@ -1242,9 +1269,9 @@ int fallible_function9_group5()
 int fallible_function11_group5();
 int fallible_function10_group5()
 {
-  auto result = non_trivial_destructor(10 * 10);
+  auto result = non_trivial_destructor(10);
   result.trigger();
-  auto result2 = non_trivial_destructor(10 * 10 * 2);
+  auto result2 = non_trivial_destructor(10);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function11_group5();
@@ -1254,9 +1281,9 @@ int fallible_function10_group5()
 int fallible_function12_group5();
 int fallible_function11_group5()
 {
-  auto result = non_trivial_destructor(11 * 11);
+  auto result = non_trivial_destructor(11);
   result.trigger();
-  auto result2 = non_trivial_destructor(11 * 11 * 2);
+  auto result2 = non_trivial_destructor(11);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function12_group5();
@@ -1266,9 +1293,9 @@ int fallible_function11_group5()
 int fallible_function13_group5();
 int fallible_function12_group5()
 {
-  auto result = non_trivial_destructor(12 * 12);
+  auto result = non_trivial_destructor(12);
   result.trigger();
-  auto result2 = non_trivial_destructor(12 * 12 * 2);
+  auto result2 = non_trivial_destructor(12);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function13_group5();
@@ -1278,9 +1305,9 @@ int fallible_function12_group5()
 int fallible_function14_group5();
 int fallible_function13_group5()
 {
-  auto result = non_trivial_destructor(13 * 13);
+  auto result = non_trivial_destructor(13);
   result.trigger();
-  auto result2 = non_trivial_destructor(13 * 13 * 2);
+  auto result2 = non_trivial_destructor(13);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function14_group5();
@@ -1290,9 +1317,9 @@ int fallible_function13_group5()
 int fallible_function15_group5();
 int fallible_function14_group5()
 {
-  auto result = non_trivial_destructor(14 * 14);
+  auto result = non_trivial_destructor(14);
   result.trigger();
-  auto result2 = non_trivial_destructor(14 * 14 * 2);
+  auto result2 = non_trivial_destructor(14);
   result2.trigger();
   side_effect5 = side_effect5 +
     fallible_function15_group5();
@@ -1301,9 +1328,9 @@ int fallible_function14_group5()
 
 int fallible_function15_group5()
 {
-  auto result = non_trivial_destructor(5 * 15);
+  auto result = non_trivial_destructor(15);
   result.trigger();
-  auto result2 = non_trivial_destructor(5 * 15);
+  auto result2 = non_trivial_destructor(15);
   result2.trigger();
   return side_effect5 + 1;
 }
@@ -1311,9 +1338,9 @@ int fallible_function15_group5()
 int fallible_function1_group6();
 int fallible_function0_group6()
 {
-  auto result = non_trivial_destructor(0 * 0);
+  auto result = non_trivial_destructor(0);
   result.trigger();
-  auto result2 = non_trivial_destructor(0 * 0 * 2);
+  auto result2 = non_trivial_destructor(0);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function1_group6();
@@ -1323,9 +1350,9 @@ int fallible_function0_group6()
 int fallible_function2_group6();
 int fallible_function1_group6()
 {
-  auto result = non_trivial_destructor(1 * 1);
+  auto result = non_trivial_destructor(1);
   result.trigger();
-  auto result2 = non_trivial_destructor(1 * 1 * 2);
+  auto result2 = non_trivial_destructor(1);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function2_group6();
@@ -1335,9 +1362,9 @@ int fallible_function1_group6()
 int fallible_function3_group6();
 int fallible_function2_group6()
 {
-  auto result = non_trivial_destructor(2 * 2);
+  auto result = non_trivial_destructor(2);
   result.trigger();
-  auto result2 = non_trivial_destructor(2 * 2 * 2);
+  auto result2 = non_trivial_destructor(2);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function3_group6();
@@ -1347,9 +1374,9 @@ int fallible_function2_group6()
 int fallible_function4_group6();
 int fallible_function3_group6()
 {
-  auto result = non_trivial_destructor(3 * 3);
+  auto result = non_trivial_destructor(3);
   result.trigger();
-  auto result2 = non_trivial_destructor(3 * 3 * 2);
+  auto result2 = non_trivial_destructor(3);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function4_group6();
@@ -1359,9 +1386,9 @@ int fallible_function3_group6()
 int fallible_function5_group6();
 int fallible_function4_group6()
 {
-  auto result = non_trivial_destructor(4 * 4);
+  auto result = non_trivial_destructor(4);
   result.trigger();
-  auto result2 = non_trivial_destructor(4 * 4 * 2);
+  auto result2 = non_trivial_destructor(4);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function5_group6();
@@ -1371,9 +1398,9 @@ int fallible_function4_group6()
 int fallible_function6_group6();
 int fallible_function5_group6()
 {
-  auto result = non_trivial_destructor(5 * 5);
+  auto result = non_trivial_destructor(5);
   result.trigger();
-  auto result2 = non_trivial_destructor(5 * 5 * 2);
+  auto result2 = non_trivial_destructor(5);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function6_group6();
@@ -1383,9 +1410,9 @@ int fallible_function5_group6()
 int fallible_function7_group6();
 int fallible_function6_group6()
 {
-  auto result = non_trivial_destructor(6 * 6);
+  auto result = non_trivial_destructor(6);
   result.trigger();
-  auto result2 = non_trivial_destructor(6 * 6 * 2);
+  auto result2 = non_trivial_destructor(6);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function7_group6();
@@ -1395,9 +1422,9 @@ int fallible_function6_group6()
 int fallible_function8_group6();
 int fallible_function7_group6()
 {
-  auto result = non_trivial_destructor(7 * 7);
+  auto result = non_trivial_destructor(7);
   result.trigger();
-  auto result2 = non_trivial_destructor(7 * 7 * 2);
+  auto result2 = non_trivial_destructor(7);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function8_group6();
@@ -1407,9 +1434,9 @@ int fallible_function7_group6()
 int fallible_function9_group6();
 int fallible_function8_group6()
 {
-  auto result = non_trivial_destructor(8 * 8);
+  auto result = non_trivial_destructor(8);
   result.trigger();
-  auto result2 = non_trivial_destructor(8 * 8 * 2);
+  auto result2 = non_trivial_destructor(8);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function9_group6();
@@ -1419,9 +1446,9 @@ int fallible_function8_group6()
 int fallible_function10_group6();
 int fallible_function9_group6()
 {
-  auto result = non_trivial_destructor(9 * 9);
+  auto result = non_trivial_destructor(9);
   result.trigger();
-  auto result2 = non_trivial_destructor(9 * 9 * 2);
+  auto result2 = non_trivial_destructor(9);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function10_group6();
@@ -1431,9 +1458,9 @@ int fallible_function9_group6()
 int fallible_function11_group6();
 int fallible_function10_group6()
 {
-  auto result = non_trivial_destructor(10 * 10);
+  auto result = non_trivial_destructor(10);
   result.trigger();
-  auto result2 = non_trivial_destructor(10 * 10 * 2);
+  auto result2 = non_trivial_destructor(10);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function11_group6();
@@ -1443,9 +1470,9 @@ int fallible_function10_group6()
 int fallible_function12_group6();
 int fallible_function11_group6()
 {
-  auto result = non_trivial_destructor(11 * 11);
+  auto result = non_trivial_destructor(11);
   result.trigger();
-  auto result2 = non_trivial_destructor(11 * 11 * 2);
+  auto result2 = non_trivial_destructor(11);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function12_group6();
@@ -1455,9 +1482,9 @@ int fallible_function11_group6()
 int fallible_function13_group6();
 int fallible_function12_group6()
 {
-  auto result = non_trivial_destructor(12 * 12);
+  auto result = non_trivial_destructor(12);
   result.trigger();
-  auto result2 = non_trivial_destructor(12 * 12 * 2);
+  auto result2 = non_trivial_destructor(12);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function13_group6();
@@ -1467,9 +1494,9 @@ int fallible_function12_group6()
 int fallible_function14_group6();
 int fallible_function13_group6()
 {
-  auto result = non_trivial_destructor(13 * 13);
+  auto result = non_trivial_destructor(13);
   result.trigger();
-  auto result2 = non_trivial_destructor(13 * 13 * 2);
+  auto result2 = non_trivial_destructor(13);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function14_group6();
@@ -1479,9 +1506,9 @@ int fallible_function13_group6()
 int fallible_function15_group6();
 int fallible_function14_group6()
 {
-  auto result = non_trivial_destructor(14 * 14);
+  auto result = non_trivial_destructor(14);
   result.trigger();
-  auto result2 = non_trivial_destructor(14 * 14 * 2);
+  auto result2 = non_trivial_destructor(14);
   result2.trigger();
   side_effect6 = side_effect6 +
     fallible_function15_group6();
@@ -1490,9 +1517,9 @@ int fallible_function14_group6()
 
 int fallible_function15_group6()
 {
-  auto result = non_trivial_destructor(6 * 15);
+  auto result = non_trivial_destructor(15);
   result.trigger();
-  auto result2 = non_trivial_destructor(6 * 15);
+  auto result2 = non_trivial_destructor(15);
   result2.trigger();
   return side_effect6 + 1;
 }
@@ -1500,9 +1527,9 @@ int fallible_function15_group6()
 int fallible_function1_group7();
 int fallible_function0_group7()
 {
-  auto result = non_trivial_destructor(0 * 0);
+  auto result = non_trivial_destructor(0);
   result.trigger();
-  auto result2 = non_trivial_destructor(0 * 0 * 2);
+  auto result2 = non_trivial_destructor(0);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function1_group7();
@@ -1512,9 +1539,9 @@ int fallible_function0_group7()
 int fallible_function2_group7();
 int fallible_function1_group7()
 {
-  auto result = non_trivial_destructor(1 * 1);
+  auto result = non_trivial_destructor(1);
   result.trigger();
-  auto result2 = non_trivial_destructor(1 * 1 * 2);
+  auto result2 = non_trivial_destructor(1);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function2_group7();
@@ -1524,9 +1551,9 @@ int fallible_function1_group7()
 int fallible_function3_group7();
 int fallible_function2_group7()
 {
-  auto result = non_trivial_destructor(2 * 2);
+  auto result = non_trivial_destructor(2);
   result.trigger();
-  auto result2 = non_trivial_destructor(2 * 2 * 2);
+  auto result2 = non_trivial_destructor(2);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function3_group7();
@@ -1536,9 +1563,9 @@ int fallible_function2_group7()
 int fallible_function4_group7();
 int fallible_function3_group7()
 {
-  auto result = non_trivial_destructor(3 * 3);
+  auto result = non_trivial_destructor(3);
   result.trigger();
-  auto result2 = non_trivial_destructor(3 * 3 * 2);
+  auto result2 = non_trivial_destructor(3);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function4_group7();
@@ -1548,9 +1575,9 @@ int fallible_function3_group7()
 int fallible_function5_group7();
 int fallible_function4_group7()
 {
-  auto result = non_trivial_destructor(4 * 4);
+  auto result = non_trivial_destructor(4);
   result.trigger();
-  auto result2 = non_trivial_destructor(4 * 4 * 2);
+  auto result2 = non_trivial_destructor(4);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function5_group7();
@@ -1560,9 +1587,9 @@ int fallible_function4_group7()
 int fallible_function6_group7();
 int fallible_function5_group7()
 {
-  auto result = non_trivial_destructor(5 * 5);
+  auto result = non_trivial_destructor(5);
   result.trigger();
-  auto result2 = non_trivial_destructor(5 * 5 * 2);
+  auto result2 = non_trivial_destructor(5);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function6_group7();
@@ -1572,9 +1599,9 @@ int fallible_function5_group7()
 int fallible_function7_group7();
 int fallible_function6_group7()
 {
-  auto result = non_trivial_destructor(6 * 6);
+  auto result = non_trivial_destructor(6);
   result.trigger();
-  auto result2 = non_trivial_destructor(6 * 6 * 2);
+  auto result2 = non_trivial_destructor(6);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function7_group7();
@@ -1584,9 +1611,9 @@ int fallible_function6_group7()
 int fallible_function8_group7();
 int fallible_function7_group7()
 {
-  auto result = non_trivial_destructor(7 * 7);
+  auto result = non_trivial_destructor(7);
   result.trigger();
-  auto result2 = non_trivial_destructor(7 * 7 * 2);
+  auto result2 = non_trivial_destructor(7);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function8_group7();
@@ -1596,9 +1623,9 @@ int fallible_function7_group7()
 int fallible_function9_group7();
 int fallible_function8_group7()
 {
-  auto result = non_trivial_destructor(8 * 8);
+  auto result = non_trivial_destructor(8);
   result.trigger();
-  auto result2 = non_trivial_destructor(8 * 8 * 2);
+  auto result2 = non_trivial_destructor(8);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function9_group7();
@@ -1608,9 +1635,9 @@ int fallible_function8_group7()
 int fallible_function10_group7();
 int fallible_function9_group7()
 {
-  auto result = non_trivial_destructor(9 * 9);
+  auto result = non_trivial_destructor(9);
   result.trigger();
-  auto result2 = non_trivial_destructor(9 * 9 * 2);
+  auto result2 = non_trivial_destructor(9);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function10_group7();
@@ -1620,9 +1647,9 @@ int fallible_function9_group7()
 int fallible_function11_group7();
 int fallible_function10_group7()
 {
-  auto result = non_trivial_destructor(10 * 10);
+  auto result = non_trivial_destructor(10);
   result.trigger();
-  auto result2 = non_trivial_destructor(10 * 10 * 2);
+  auto result2 = non_trivial_destructor(10);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function11_group7();
@@ -1632,9 +1659,9 @@ int fallible_function10_group7()
 int fallible_function12_group7();
 int fallible_function11_group7()
 {
-  auto result = non_trivial_destructor(11 * 11);
+  auto result = non_trivial_destructor(11);
   result.trigger();
-  auto result2 = non_trivial_destructor(11 * 11 * 2);
+  auto result2 = non_trivial_destructor(11);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function12_group7();
@@ -1644,9 +1671,9 @@ int fallible_function11_group7()
 int fallible_function13_group7();
 int fallible_function12_group7()
 {
-  auto result = non_trivial_destructor(12 * 12);
+  auto result = non_trivial_destructor(12);
   result.trigger();
-  auto result2 = non_trivial_destructor(12 * 12 * 2);
+  auto result2 = non_trivial_destructor(12);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function13_group7();
@@ -1656,9 +1683,9 @@ int fallible_function12_group7()
 int fallible_function14_group7();
 int fallible_function13_group7()
 {
-  auto result = non_trivial_destructor(13 * 13);
+  auto result = non_trivial_destructor(13);
   result.trigger();
-  auto result2 = non_trivial_destructor(13 * 13 * 2);
+  auto result2 = non_trivial_destructor(13);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function14_group7();
@@ -1668,9 +1695,9 @@ int fallible_function13_group7()
 int fallible_function15_group7();
 int fallible_function14_group7()
 {
-  auto result = non_trivial_destructor(14 * 14);
+  auto result = non_trivial_destructor(14);
   result.trigger();
-  auto result2 = non_trivial_destructor(14 * 14 * 2);
+  auto result2 = non_trivial_destructor(14);
   result2.trigger();
   side_effect7 = side_effect7 +
     fallible_function15_group7();
@@ -1679,9 +1706,9 @@ int fallible_function14_group7()
 
 int fallible_function15_group7()
 {
-  auto result = non_trivial_destructor(7 * 15);
+  auto result = non_trivial_destructor(15);
   result.trigger();
-  auto result2 = non_trivial_destructor(7 * 15);
+  auto result2 = non_trivial_destructor(15);
   result2.trigger();
   return side_effect7 + 1;
 }
@@ -1689,9 +1716,9 @@ int fallible_function15_group7()
 int fallible_function1_group8();
 int fallible_function0_group8()
 {
-  auto result = non_trivial_destructor(0 * 0);
+  auto result = non_trivial_destructor(0);
   result.trigger();
-  auto result2 = non_trivial_destructor(0 * 0 * 2);
+  auto result2 = non_trivial_destructor(0);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function1_group8();
@@ -1701,9 +1728,9 @@ int fallible_function0_group8()
 int fallible_function2_group8();
 int fallible_function1_group8()
 {
-  auto result = non_trivial_destructor(1 * 1);
+  auto result = non_trivial_destructor(1);
   result.trigger();
-  auto result2 = non_trivial_destructor(1 * 1 * 2);
+  auto result2 = non_trivial_destructor(1);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function2_group8();
@@ -1713,9 +1740,9 @@ int fallible_function1_group8()
 int fallible_function3_group8();
 int fallible_function2_group8()
 {
-  auto result = non_trivial_destructor(2 * 2);
+  auto result = non_trivial_destructor(2);
   result.trigger();
-  auto result2 = non_trivial_destructor(2 * 2 * 2);
+  auto result2 = non_trivial_destructor(2);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function3_group8();
@@ -1725,9 +1752,9 @@ int fallible_function2_group8()
 int fallible_function4_group8();
 int fallible_function3_group8()
 {
-  auto result = non_trivial_destructor(3 * 3);
+  auto result = non_trivial_destructor(3);
   result.trigger();
-  auto result2 = non_trivial_destructor(3 * 3 * 2);
+  auto result2 = non_trivial_destructor(3);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function4_group8();
@@ -1737,9 +1764,9 @@ int fallible_function3_group8()
 int fallible_function5_group8();
 int fallible_function4_group8()
 {
-  auto result = non_trivial_destructor(4 * 4);
+  auto result = non_trivial_destructor(4);
   result.trigger();
-  auto result2 = non_trivial_destructor(4 * 4 * 2);
+  auto result2 = non_trivial_destructor(4);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function5_group8();
@@ -1749,9 +1776,9 @@ int fallible_function4_group8()
 int fallible_function6_group8();
 int fallible_function5_group8()
 {
-  auto result = non_trivial_destructor(5 * 5);
+  auto result = non_trivial_destructor(5);
   result.trigger();
-  auto result2 = non_trivial_destructor(5 * 5 * 2);
+  auto result2 = non_trivial_destructor(5);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function6_group8();
@@ -1761,9 +1788,9 @@ int fallible_function5_group8()
 int fallible_function7_group8();
 int fallible_function6_group8()
 {
-  auto result = non_trivial_destructor(6 * 6);
+  auto result = non_trivial_destructor(6);
   result.trigger();
-  auto result2 = non_trivial_destructor(6 * 6 * 2);
+  auto result2 = non_trivial_destructor(6);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function7_group8();
@@ -1773,9 +1800,9 @@ int fallible_function6_group8()
 int fallible_function8_group8();
 int fallible_function7_group8()
 {
-  auto result = non_trivial_destructor(7 * 7);
+  auto result = non_trivial_destructor(7);
   result.trigger();
-  auto result2 = non_trivial_destructor(7 * 7 * 2);
+  auto result2 = non_trivial_destructor(7);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function8_group8();
@@ -1785,9 +1812,9 @@ int fallible_function7_group8()
 int fallible_function9_group8();
 int fallible_function8_group8()
 {
-  auto result = non_trivial_destructor(8 * 8);
+  auto result = non_trivial_destructor(8);
   result.trigger();
-  auto result2 = non_trivial_destructor(8 * 8 * 2);
+  auto result2 = non_trivial_destructor(8);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function9_group8();
@@ -1797,9 +1824,9 @@ int fallible_function8_group8()
 int fallible_function10_group8();
 int fallible_function9_group8()
 {
-  auto result = non_trivial_destructor(9 * 9);
+  auto result = non_trivial_destructor(9);
   result.trigger();
-  auto result2 = non_trivial_destructor(9 * 9 * 2);
+  auto result2 = non_trivial_destructor(9);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function10_group8();
@@ -1809,9 +1836,9 @@ int fallible_function9_group8()
 int fallible_function11_group8();
 int fallible_function10_group8()
 {
-  auto result = non_trivial_destructor(10 * 10);
+  auto result = non_trivial_destructor(10);
   result.trigger();
-  auto result2 = non_trivial_destructor(10 * 10 * 2);
+  auto result2 = non_trivial_destructor(10);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function11_group8();
@@ -1821,9 +1848,9 @@ int fallible_function10_group8()
 int fallible_function12_group8();
 int fallible_function11_group8()
 {
-  auto result = non_trivial_destructor(11 * 11);
+  auto result = non_trivial_destructor(11);
   result.trigger();
-  auto result2 = non_trivial_destructor(11 * 11 * 2);
+  auto result2 = non_trivial_destructor(11);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function12_group8();
@@ -1833,9 +1860,9 @@ int fallible_function11_group8()
 int fallible_function13_group8();
 int fallible_function12_group8()
 {
-  auto result = non_trivial_destructor(12 * 12);
+  auto result = non_trivial_destructor(12);
   result.trigger();
-  auto result2 = non_trivial_destructor(12 * 12 * 2);
+  auto result2 = non_trivial_destructor(12);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function13_group8();
@@ -1845,9 +1872,9 @@ int fallible_function12_group8()
 int fallible_function14_group8();
 int fallible_function13_group8()
 {
-  auto result = non_trivial_destructor(13 * 13);
+  auto result = non_trivial_destructor(13);
   result.trigger();
-  auto result2 = non_trivial_destructor(13 * 13 * 2);
+  auto result2 = non_trivial_destructor(13);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function14_group8();
@@ -1857,9 +1884,9 @@ int fallible_function13_group8()
 int fallible_function15_group8();
 int fallible_function14_group8()
 {
-  auto result = non_trivial_destructor(14 * 14);
+  auto result = non_trivial_destructor(14);
   result.trigger();
-  auto result2 = non_trivial_destructor(14 * 14 * 2);
+  auto result2 = non_trivial_destructor(14);
   result2.trigger();
   side_effect8 = side_effect8 +
     fallible_function15_group8();
@@ -1868,9 +1895,9 @@ int fallible_function14_group8()
 
 int fallible_function15_group8()
 {
-  auto result = non_trivial_destructor(8 * 15);
+  auto result = non_trivial_destructor(15);
   result.trigger();
-  auto result2 = non_trivial_destructor(8 * 15);
+  auto result2 = non_trivial_destructor(15);
   result2.trigger();
   return side_effect8 + 1;
 }
@@ -1878,9 +1905,9 @@ int fallible_function15_group8()
 int fallible_function1_group9();
 int fallible_function0_group9()
 {
-  auto result = non_trivial_destructor(0 * 0);
+  auto result = non_trivial_destructor(0);
   result.trigger();
-  auto result2 = non_trivial_destructor(0 * 0 * 2);
+  auto result2 = non_trivial_destructor(0);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function1_group9();
@@ -1890,9 +1917,9 @@ int fallible_function0_group9()
 int fallible_function2_group9();
 int fallible_function1_group9()
 {
-  auto result = non_trivial_destructor(1 * 1);
+  auto result = non_trivial_destructor(1);
   result.trigger();
-  auto result2 = non_trivial_destructor(1 * 1 * 2);
+  auto result2 = non_trivial_destructor(1);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function2_group9();
@@ -1902,9 +1929,9 @@ int fallible_function1_group9()
 int fallible_function3_group9();
 int fallible_function2_group9()
 {
-  auto result = non_trivial_destructor(2 * 2);
+  auto result = non_trivial_destructor(2);
   result.trigger();
-  auto result2 = non_trivial_destructor(2 * 2 * 2);
+  auto result2 = non_trivial_destructor(2);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function3_group9();
@@ -1914,9 +1941,9 @@ int fallible_function2_group9()
 int fallible_function4_group9();
 int fallible_function3_group9()
 {
-  auto result = non_trivial_destructor(3 * 3);
+  auto result = non_trivial_destructor(3);
   result.trigger();
-  auto result2 = non_trivial_destructor(3 * 3 * 2);
+  auto result2 = non_trivial_destructor(3);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function4_group9();
@@ -1926,9 +1953,9 @@ int fallible_function3_group9()
 int fallible_function5_group9();
 int fallible_function4_group9()
 {
-  auto result = non_trivial_destructor(4 * 4);
+  auto result = non_trivial_destructor(4);
   result.trigger();
-  auto result2 = non_trivial_destructor(4 * 4 * 2);
+  auto result2 = non_trivial_destructor(4);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function5_group9();
@@ -1938,9 +1965,9 @@ int fallible_function4_group9()
 int fallible_function6_group9();
 int fallible_function5_group9()
 {
-  auto result = non_trivial_destructor(5 * 5);
+  auto result = non_trivial_destructor(5);
   result.trigger();
-  auto result2 = non_trivial_destructor(5 * 5 * 2);
+  auto result2 = non_trivial_destructor(5);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function6_group9();
@@ -1950,9 +1977,9 @@ int fallible_function5_group9()
 int fallible_function7_group9();
 int fallible_function6_group9()
 {
-  auto result = non_trivial_destructor(6 * 6);
+  auto result = non_trivial_destructor(6);
   result.trigger();
-  auto result2 = non_trivial_destructor(6 * 6 * 2);
+  auto result2 = non_trivial_destructor(6);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function7_group9();
@@ -1962,9 +1989,9 @@ int fallible_function6_group9()
 int fallible_function8_group9();
 int fallible_function7_group9()
 {
-  auto result = non_trivial_destructor(7 * 7);
+  auto result = non_trivial_destructor(7);
   result.trigger();
-  auto result2 = non_trivial_destructor(7 * 7 * 2);
+  auto result2 = non_trivial_destructor(7);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function8_group9();
@@ -1974,9 +2001,9 @@ int fallible_function7_group9()
 int fallible_function9_group9();
 int fallible_function8_group9()
 {
-  auto result = non_trivial_destructor(8 * 8);
+  auto result = non_trivial_destructor(8);
   result.trigger();
-  auto result2 = non_trivial_destructor(8 * 8 * 2);
+  auto result2 = non_trivial_destructor(8);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function9_group9();
@@ -1986,9 +2013,9 @@ int fallible_function8_group9()
 int fallible_function10_group9();
 int fallible_function9_group9()
 {
-  auto result = non_trivial_destructor(9 * 9);
+  auto result = non_trivial_destructor(9);
   result.trigger();
-  auto result2 = non_trivial_destructor(9 * 9 * 2);
+  auto result2 = non_trivial_destructor(9);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function10_group9();
@@ -1998,9 +2025,9 @@ int fallible_function9_group9()
 int fallible_function11_group9();
 int fallible_function10_group9()
 {
-  auto result = non_trivial_destructor(10 * 10);
+  auto result = non_trivial_destructor(10);
   result.trigger();
-  auto result2 = non_trivial_destructor(10 * 10 * 2);
+  auto result2 = non_trivial_destructor(10);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function11_group9();
@@ -2010,9 +2037,9 @@ int fallible_function10_group9()
 int fallible_function12_group9();
 int fallible_function11_group9()
 {
-  auto result = non_trivial_destructor(11 * 11);
+  auto result = non_trivial_destructor(11);
   result.trigger();
-  auto result2 = non_trivial_destructor(11 * 11 * 2);
+  auto result2 = non_trivial_destructor(11);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function12_group9();
@@ -2022,9 +2049,9 @@ int fallible_function11_group9()
 int fallible_function13_group9();
 int fallible_function12_group9()
 {
-  auto result = non_trivial_destructor(12 * 12);
+  auto result = non_trivial_destructor(12);
   result.trigger();
-  auto result2 = non_trivial_destructor(12 * 12 * 2);
+  auto result2 = non_trivial_destructor(12);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function13_group9();
@@ -2034,9 +2061,9 @@ int fallible_function12_group9()
 int fallible_function14_group9();
 int fallible_function13_group9()
 {
-  auto result = non_trivial_destructor(13 * 13);
+  auto result = non_trivial_destructor(13);
   result.trigger();
-  auto result2 = non_trivial_destructor(13 * 13 * 2);
+  auto result2 = non_trivial_destructor(13);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function14_group9();
@@ -2046,9 +2073,9 @@ int fallible_function13_group9()
 int fallible_function15_group9();
 int fallible_function14_group9()
 {
-  auto result = non_trivial_destructor(14 * 14);
+  auto result = non_trivial_destructor(14);
   result.trigger();
-  auto result2 = non_trivial_destructor(14 * 14 * 2);
+  auto result2 = non_trivial_destructor(14);
   result2.trigger();
   side_effect9 = side_effect9 +
     fallible_function15_group9();
@@ -2057,9 +2084,9 @@ int fallible_function14_group9()
 
 int fallible_function15_group9()
 {
-  auto result = non_trivial_destructor(9 * 15);
+  auto result = non_trivial_destructor(15);
   result.trigger();
-  auto result2 = non_trivial_destructor(9 * 15);
+  auto result2 = non_trivial_destructor(15);
   result2.trigger();
   return side_effect9 + 1;
 }
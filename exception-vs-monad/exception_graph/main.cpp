@@ -0,0 +1,707 @@
+
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#else
+#define HARNESS_STATE
+#endif
+
+constexpr size_t error_size = 128;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
+constexpr uint32_t depth_before_exception = 1000;
+#endif
+
+struct error_t
+{
+  std::array<std::uint8_t, error_size> data;
+};
+
+HARNESS_STATE volatile std::uint64_t enable_register;
+HARNESS_STATE volatile std::uint64_t trigger_register;
+HARNESS_STATE volatile int side_effect = 0;
+HARNESS_STATE volatile int handled_errors = 0;
+
+class non_trivial_destructor
+{
+public:
+  non_trivial_destructor(uint32_t p_channel)
+    : m_channel(p_channel)
+  {
+    if (p_channel >= depth_before_exception) {
+      throw error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } };
+    }
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
+  }
+
+  non_trivial_destructor(non_trivial_destructor&) = delete;
+  non_trivial_destructor& operator=(non_trivial_destructor&) = delete;
+  non_trivial_destructor(non_trivial_destructor&&) noexcept = default;
+  non_trivial_destructor& operator=(non_trivial_destructor&&) noexcept =
+    default;
+
+  ~non_trivial_destructor()
+  {
+    enable_register =
+      enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
+  }
+
+  void trigger()
+  {
+    if (m_channel >= depth_before_exception) {
+      throw error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } };
+    }
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
+  }
+
+private:
+  uint32_t m_channel = 0;
+};
+
+int return_error();
+int top_call()
+{
+  return return_error();
+}
+
+#if defined(HOST_BENCHMARK)
+int harness::call_top()
+#else
+int main()
+#endif
+{
+  volatile int return_code = 0;
+  try {
+    return_code = top_call();
+  } catch (const error_t& p_error) {
+    return p_error.data[0];
+  } catch (...) {
+    return 15;
+  }
+  return return_code;
+}
+
+#if !defined(HOST_BENCHMARK)
+extern "C"
+{
+  void _exit([[maybe_unused]] int rc)
+  {
+    while (true) {
+      continue;
+    }
+  }
+
+  int kill(int, int)
+  {
+    return -1;
+  }
+
+  struct _reent* _impure_ptr = nullptr;
+
+  int getpid()
+  {
+    return 1;
+  }
+}
+
+[[noreturn]] void my_terminate() noexcept
+{
+  while (true) {
+    continue;
+  }
+}
+
+namespace __cxxabiv1 {
+std::terminate_handler __terminate_handler = my_terminate;
+}
+#endif
+
+// =============================================================================
+// Add generated code below
+// =============================================================================
+
+
+#if defined(HOST_BENCHMARK)
+// Fail in the last layer so the error starts in the deepest frames
+const std::uint32_t harness::failing_threshold = 15;
+const harness::result_layout harness::layout =
+  harness::describe<error_t, decltype(top_call())>();
+#endif
+
+int fallible_helper0(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor(p_channel);
+  object0.trigger();
+  return side_effect;
+}
+
+int fallible_helper1(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor(p_channel);
+  object0.trigger();
+  return side_effect;
+}
+
+int fallible_helper2(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor(p_channel);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(p_channel);
+  object1.trigger();
+  return side_effect;
+}
+
+int fallible_helper3(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor(p_channel);
+  object0.trigger();
+  return side_effect;
+}
+
+int fallible_helper4(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor(p_channel);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(p_channel);
+  object1.trigger();
+  return side_effect;
+}
+
+int fallible_helper5(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor(p_channel);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(p_channel);
+  object1.trigger();
+  return side_effect;
+}
+
+int fallible_helper6(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor(p_channel);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(p_channel);
+  object1.trigger();
+  return side_effect;
+}
+
+int fallible_helper7(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor(p_channel);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(p_channel);
+  object1.trigger();
+  return side_effect;
+}
+
+int fallible_function15_group0()
+{
+  auto object0 = non_trivial_destructor(15);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(15);
+  object1.trigger();
+  side_effect = side_effect + fallible_helper1(15);
+  return side_effect;
+}
+
+int fallible_function14_group0()
+{
+  side_effect = side_effect + fallible_function15_group0();
+  side_effect = side_effect + fallible_helper5(14);
+  return side_effect;
+}
+
+int fallible_function13_group0()
+{
+  auto object0 = non_trivial_destructor(13);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(13);
+  object1.trigger();
+  side_effect = side_effect + fallible_function14_group0();
+  return side_effect;
+}
+
+int fallible_function12_group0()
+{
+  auto object0 = non_trivial_destructor(12);
+  object0.trigger();
+  try {
+    side_effect = side_effect + fallible_function13_group0();
+  } catch (const error_t&) {
+    handled_errors = handled_errors + 1;
+  }
+  return side_effect;
+}
+
+int fallible_function11_group0()
+{
+  for (int i = 0; i < 4; i++) {
+    side_effect = side_effect + fallible_helper5(11);
+  }
+  try {
+    side_effect = side_effect + fallible_function12_group0();
+  } catch (const error_t&) {
+    handled_errors = handled_errors + 1;
+  }
+  side_effect = side_effect + fallible_helper7(11);
+  return side_effect;
+}
+
+int fallible_function10_group0()
+{
+  auto object0 = non_trivial_destructor(10);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(10);
+  object1.trigger();
+  side_effect = side_effect + fallible_function11_group0();
+  side_effect = side_effect + fallible_helper6(10);
+  return side_effect;
+}
+
+int fallible_function9_group0()
+{
+  auto object0 = non_trivial_destructor(9);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(9);
+  object1.trigger();
+  side_effect = side_effect + fallible_function10_group0();
+  return side_effect;
+}
+
+int fallible_function8_group0()
+{
+  side_effect = side_effect + fallible_function9_group0();
+  side_effect = side_effect + fallible_helper1(8);
+  for (int i = 0; i < 2; i++) {
+    side_effect = side_effect + fallible_helper2(8);
+  }
+  return side_effect;
+}
+
+int fallible_function7_group0()
+{
+  auto object0 = non_trivial_destructor(7);
+  object0.trigger();
+  for (int i = 0; i < 2; i++) {
+    side_effect = side_effect + fallible_helper3(7);
+  }
+  side_effect = side_effect + fallible_function8_group0();
+  return side_effect;
+}
+
+int fallible_function6_group0()
+{
+  auto object0 = non_trivial_destructor(6);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(6);
+  object1.trigger();
+  side_effect = side_effect + fallible_helper1(6);
+  side_effect = side_effect + fallible_function7_group0();
+  return side_effect;
+}
+
+int fallible_function6_group1()
+{
+  auto object0 = non_trivial_destructor(6);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(6);
+  object1.trigger();
+  for (int i = 0; i < 4; i++) {
+    side_effect = side_effect + fallible_helper0(6);
+  }
+  side_effect = side_effect + fallible_function7_group0();
+  return side_effect;
+}
+
+int fallible_function5_group0()
+{
+  auto object0 = non_trivial_destructor(5);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(5);
+  object1.trigger();
+  try {
+    side_effect = side_effect + fallible_function6_group0();
+  } catch (const error_t&) {
+    handled_errors = handled_errors + 1;
+  }
+  for (int i = 0; i < 2; i++) {
+    side_effect = side_effect + fallible_helper2(5);
+  }
+  return side_effect;
+}
+
+int fallible_function5_group1()
+{
+  side_effect = side_effect + fallible_function6_group1();
+  return side_effect;
+}
+
+int fallible_function5_group2()
+{
+  auto object0 = non_trivial_destructor(5);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(5);
+  object1.trigger();
+  side_effect = side_effect + fallible_helper6(5);
+  side_effect = side_effect + fallible_function6_group0();
+  side_effect = side_effect + fallible_helper3(5);
+  return side_effect;
+}
+
+int fallible_function5_group3()
+{
+  auto object0 = non_trivial_destructor(5);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(5);
+  object1.trigger();
+  side_effect = side_effect + fallible_function6_group1();
+  return side_effect;
+}
+
+int fallible_function5_group4()
+{
+  auto object0 = non_trivial_destructor(5);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(5);
+  object1.trigger();
+  side_effect = side_effect + fallible_helper4(5);
+  side_effect = side_effect + fallible_function6_group1();
+  return side_effect;
+}
+
+int fallible_function4_group0()
+{
+  side_effect = side_effect + fallible_function5_group0();
+  return side_effect;
+}
+
+int fallible_function4_group1()
+{
+  side_effect = side_effect + fallible_function5_group1();
+  side_effect = side_effect + fallible_helper1(4);
+  for (int i = 0; i < 3; i++) {
+    side_effect = side_effect + fallible_helper4(4);
+  }
+  return side_effect;
+}
+
+int fallible_function4_group2()
+{
+  auto object0 = non_trivial_destructor(4);
+  object0.trigger();
+  side_effect = side_effect + fallible_function5_group2();
+  return side_effect;
+}
+
+int fallible_function4_group3()
+{
+  auto object0 = non_trivial_destructor(4);
+  object0.trigger();
+  side_effect = side_effect + fallible_helper7(4);
+  side_effect = side_effect + fallible_helper1(4);
+  side_effect = side_effect + fallible_function5_group3();
+  return side_effect;
+}
+
+int fallible_function4_group4()
+{
+  auto object0 = non_trivial_destructor(4);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(4);
+  object1.trigger();
+  side_effect = side_effect + fallible_function5_group4();
+  return side_effect;
+}
+
+int fallible_function3_group0()
+{
+  auto object0 = non_trivial_destructor(3);
+  object0.trigger();
+  side_effect = side_effect + fallible_function4_group0();
+  return side_effect;
+}
+
+int fallible_function3_group1()
+{
+  auto object0 = non_trivial_destructor(3);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(3);
+  object1.trigger();
+  side_effect = side_effect + fallible_function4_group1();
+  side_effect = side_effect + fallible_helper2(3);
+  return side_effect;
+}
+
+int fallible_function3_group2()
+{
+  auto object0 = non_trivial_destructor(3);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(3);
+  object1.trigger();
+  side_effect = side_effect + fallible_function4_group2();
+  for (int i = 0; i < 4; i++) {
+    side_effect = side_effect + fallible_helper1(3);
+  }
+  return side_effect;
+}
+
+int fallible_function3_group3()
+{
+  for (int i = 0; i < 2; i++) {
+    side_effect = side_effect + fallible_helper1(3);
+  }
+  side_effect = side_effect + fallible_helper7(3);
+  side_effect = side_effect + fallible_function4_group3();
+  return side_effect;
+}
+
+int fallible_function3_group4()
+{
+  auto object0 = non_trivial_destructor(3);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(3);
+  object1.trigger();
+  side_effect = side_effect + fallible_function4_group4();
+  return side_effect;
+}
+
+int fallible_function2_group0()
+{
+  auto object0 = non_trivial_destructor(2);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(2);
+  object1.trigger();
+  side_effect = side_effect + fallible_function3_group0();
+  return side_effect;
+}
+
+int fallible_function2_group1()
+{
+  side_effect = side_effect + fallible_helper7(2);
+  side_effect = side_effect + fallible_helper0(2);
+  side_effect = side_effect + fallible_function3_group1();
+  return side_effect;
+}
+
+int fallible_function2_group2()
+{
+  auto object0 = non_trivial_destructor(2);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(2);
+  object1.trigger();
+  side_effect = side_effect + fallible_function3_group2();
+  side_effect = side_effect + fallible_helper0(2);
+  for (int i = 0; i < 2; i++) {
+    side_effect = side_effect + fallible_helper3(2);
+  }
+  return side_effect;
+}
+
+int fallible_function2_group3()
+{
+  auto object0 = non_trivial_destructor(2);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(2);
+  object1.trigger();
+  side_effect = side_effect + fallible_function3_group3();
+  for (int i = 0; i < 4; i++) {
+    side_effect = side_effect + fallible_helper6(2);
+  }
+  side_effect = side_effect + fallible_helper3(2);
+  return side_effect;
+}
+
+int fallible_function2_group4()
+{
+  auto object0 = non_trivial_destructor(2);
+  object0.trigger();
+  side_effect = side_effect + fallible_helper0(2);
+  side_effect = side_effect + fallible_function3_group4();
+  side_effect = side_effect + fallible_helper5(2);
+  return side_effect;
+}
+
+int fallible_function1_group0()
+{
+  auto object0 = non_trivial_destructor(1);
+  object0.trigger();
+  side_effect = side_effect + fallible_helper7(1);
+  side_effect = side_effect + fallible_helper6(1);
+  side_effect = side_effect + fallible_function2_group0();
+  return side_effect;
+}
+
+int fallible_function1_group1()
+{
+  auto object0 = non_trivial_destructor(1);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(1);
+  object1.trigger();
+  side_effect = side_effect + fallible_helper6(1);
+  side_effect = side_effect + fallible_function2_group1();
+  side_effect = side_effect + fallible_helper6(1);
+  return side_effect;
+}
+
+int fallible_function1_group2()
+{
+  auto object0 = non_trivial_destructor(1);
+  object0.trigger();
+  side_effect = side_effect + fallible_helper3(1);
+  side_effect = side_effect + fallible_helper1(1);
+  side_effect = side_effect + fallible_function2_group2();
+  return side_effect;
+}
+
+int fallible_function1_group3()
+{
+  auto object0 = non_trivial_destructor(1);
+  object0.trigger();
+  side_effect = side_effect + fallible_function2_group3();
+  side_effect = side_effect + fallible_helper6(1);
+  return side_effect;
+}
+
+int fallible_function1_group4()
+{
+  auto object0 = non_trivial_destructor(1);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(1);
+  object1.trigger();
+  side_effect = side_effect + fallible_function2_group4();
+  return side_effect;
+}
+
+int fallible_function0_group0()
+{
+  side_effect = side_effect + fallible_function1_group0();
+  return side_effect;
+}
+
+int fallible_function0_group1()
+{
+  for (int i = 0; i < 3; i++) {
+    side_effect = side_effect + fallible_helper1(0);
+  }
+  side_effect = side_effect + fallible_function1_group0();
+  for (int i = 0; i < 4; i++) {
+    side_effect = side_effect + fallible_helper2(0);
+  }
+  return side_effect;
+}
+
+int fallible_function0_group2()
+{
+  auto object0 = non_trivial_destructor(0);
+  object0.trigger();
+  side_effect = side_effect + fallible_function1_group0();
+  side_effect = side_effect + fallible_helper4(0);
+  return side_effect;
+}
+
+int fallible_function0_group3()
+{
+  side_effect = side_effect + fallible_helper7(0);
+  for (int i = 0; i < 3; i++) {
+    side_effect = side_effect + fallible_helper5(0);
+  }
+  side_effect = side_effect + fallible_function1_group0();
+  return side_effect;
+}
+
+int fallible_function0_group4()
+{
+  auto object0 = non_trivial_destructor(0);
+  object0.trigger();
+  try {
+    side_effect = side_effect + fallible_function1_group1();
+  } catch (const error_t&) {
+    handled_errors = handled_errors + 1;
+  }
+  return side_effect;
+}
+
+int fallible_function0_group5()
+{
+  auto object0 = non_trivial_destructor(0);
+  object0.trigger();
+  side_effect = side_effect + fallible_function1_group1();
+  for (int i = 0; i < 4; i++) {
+    side_effect = side_effect + fallible_helper3(0);
+  }
+  return side_effect;
+}
+
+int fallible_function0_group6()
+{
+  auto object0 = non_trivial_destructor(0);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(0);
+  object1.trigger();
+  side_effect = side_effect + fallible_function1_group2();
+  return side_effect;
+}
+
+int fallible_function0_group7()
+{
+  side_effect = side_effect + fallible_function1_group1();
+  return side_effect;
+}
+
+int fallible_function0_group8()
+{
+  auto object0 = non_trivial_destructor(0);
+  object0.trigger();
+  auto object1 = non_trivial_destructor(0);
+  object1.trigger();
+  side_effect = side_effect + fallible_function1_group3();
+  return side_effect;
+}
+
+int fallible_function0_group9()
+{
+  auto object0 = non_trivial_destructor(0);
+  object0.trigger();
+  side_effect = side_effect + fallible_function1_group4();
+  for (int i = 0; i < 4; i++) {
+    side_effect = side_effect + fallible_helper2(0);
+  }
+  return side_effect;
+}
+
+int return_error()
+{
+  fallible_function0_group0();
+  fallible_function0_group1();
+  fallible_function0_group2();
+  fallible_function0_group3();
+  fallible_function0_group4();
+  fallible_function0_group5();
+  fallible_function0_group6();
+  fallible_function0_group7();
+  fallible_function0_group8();
+  fallible_function0_group9();
+  return side_effect;
+}
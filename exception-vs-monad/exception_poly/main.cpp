@@ -20,10 +20,18 @@
 #include <exception>
 #include <string_view>
 
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#endif
+
 constexpr size_t error_size = 128;
 constexpr bool check_bounds_in_constructor = true;
 constexpr bool check_bounds_in_class_function = true;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
 constexpr uint32_t depth_before_exception = 1000;
+#endif
 
 struct my_error_t
 {
@@ -69,7 +77,8 @@ public:
         throw my_runtime_exception{ "p_channel is out of bounds"sv };
       }
     }
-    enable_register = enable_register | (1 << (p_channel % 64));
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
   }
 
   non_trivial_destructor(non_trivial_destructor&) = delete;
@@ -80,7 +89,8 @@ public:
 
   ~non_trivial_destructor()
   {
-    enable_register = enable_register & ~(1 << m_channel);
+    enable_register =
+      enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
   }
 
   void trigger()
@@ -90,7 +100,8 @@ public:
         throw my_error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } };
       }
     }
-    trigger_register = trigger_register | (1 << (m_channel % 64));
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
   }
 
 private:
@@ -103,7 +114,14 @@ int top_call()
   return return_error();
 }
 
+#if defined(HOST_BENCHMARK)
+const std::uint32_t harness::failing_threshold = 1000;
+const harness::result_layout harness::layout =
+  harness::describe<my_error_t, decltype(top_call())>();
+int harness::call_top()
+#else
 int main()
+#endif
 {
   volatile int return_code = 0;
   try {
@@ -130,6 +148,7 @@ int return_error()
   return side_effect0;
 }
 
+#if !defined(HOST_BENCHMARK)
 extern "C"
 {
   void _exit([[maybe_unused]] int rc)
@@ -158,4 +177,5 @@ extern "C"
 
 namespace __cxxabiv1 {
 std::terminate_handler __terminate_handler = terminate;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,61 @@
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Cache options of the programs that can take thrown exceptions from
+# exception_pool.cpp instead of the heap. Include this file, then call
+#
+#   exception_pool_options(<target>)
+#
+# on the program's target. EXCEPTION_POOL makes the arena the only place
+# thrown exceptions come from. EXCEPTION_EMERGENCY_POOL keeps malloc first and
+# makes the arena libstdc++'s emergency pool instead, in .bss, so libstdc++'s
+# own is never linked. 0 slots leaves the emergency pool out.
+
+option(EXCEPTION_POOL
+    "Allocate thrown exceptions from a static arena instead of the heap" OFF)
+set(EXCEPTION_POOL_SLOTS 2 CACHE STRING
+    "Exceptions that can be alive at once with EXCEPTION_POOL")
+set(EXCEPTION_POOL_OBJECT_SIZE 256 CACHE STRING
+    "Largest thrown object in bytes with EXCEPTION_POOL")
+set(EXCEPTION_EMERGENCY_POOL "libstdc++" CACHE STRING
+    "Emergency pool slots, or libstdc++ to keep the runtime's own pool")
+
+set(exception_pool_source ${CMAKE_CURRENT_LIST_DIR}/exception_pool.cpp)
+
+function(exception_pool_options target)
+    if(EXCEPTION_POOL)
+        target_sources(${target} PRIVATE ${exception_pool_source})
+        target_compile_definitions(${target} PRIVATE
+            EXCEPTION_POOL
+            EXCEPTION_POOL_SLOTS=${EXCEPTION_POOL_SLOTS}
+            EXCEPTION_POOL_OBJECT_SIZE=${EXCEPTION_POOL_OBJECT_SIZE})
+    endif()
+
+    if(NOT EXCEPTION_EMERGENCY_POOL STREQUAL "libstdc++")
+        if(NOT EXCEPTION_EMERGENCY_POOL MATCHES "^[0-9]+$")
+            message(FATAL_ERROR "EXCEPTION_EMERGENCY_POOL must be a number of "
+                "slots or libstdc++")
+        endif()
+        if(EXCEPTION_POOL)
+            message(FATAL_ERROR
+                "EXCEPTION_POOL and EXCEPTION_EMERGENCY_POOL both replace "
+                "libstdc++'s exception allocation, set only one of them")
+        endif()
+        target_sources(${target} PRIVATE ${exception_pool_source})
+        target_compile_definitions(${target} PRIVATE
+            EXCEPTION_POOL_HEAP_FIRST
+            EXCEPTION_POOL_SLOTS=${EXCEPTION_EMERGENCY_POOL}
+            EXCEPTION_POOL_OBJECT_SIZE=${EXCEPTION_POOL_OBJECT_SIZE})
+    endif()
+endfunction()
@@ -0,0 +1,149 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+
+#include <cxxabi.h>
+
+#include "exception_pool.hpp"
+
+namespace exception_pool {
+namespace {
+alignas(alignment) std::array<std::byte, arena_size> arena;
+std::array<std::atomic<bool>, slots> taken{};
+
+std::atomic<std::uint32_t> allocations{ 0 };
+std::atomic<std::uint32_t> in_use{ 0 };
+std::atomic<std::uint32_t> high_water_slots{ 0 };
+std::atomic<std::size_t> high_water_bytes{ 0 };
+
+template<typename T>
+void raise_to(std::atomic<T>& p_mark, T p_value)
+{
+  auto mark = p_mark.load(std::memory_order_relaxed);
+  while (mark < p_value && !p_mark.compare_exchange_weak(
+                              mark, p_value, std::memory_order_relaxed)) {
+    continue;
+  }
+}
+
+void* claim(std::size_t p_bytes)
+{
+  if (p_bytes > slot_size) {
+    std::terminate();
+  }
+
+  for (std::size_t slot = 0; slot < slots; slot++) {
+    if (!taken[slot].exchange(true, std::memory_order_acquire)) {
+      allocations.fetch_add(1, std::memory_order_relaxed);
+      auto held = in_use.fetch_add(1, std::memory_order_relaxed) + 1;
+      raise_to(high_water_slots, held);
+      raise_to(high_water_bytes, p_bytes);
+      return arena.data() + slot * slot_size;
+    }
+  }
+
+  std::terminate();
+}
+
+void release(void* p_block)
+{
+  auto offset = static_cast<std::byte*>(p_block) - arena.data();
+  auto slot = static_cast<std::size_t>(offset) / slot_size;
+  in_use.fetch_sub(1, std::memory_order_relaxed);
+  taken[slot].store(false, std::memory_order_release);
+}
+
+void* allocate(std::size_t p_bytes)
+{
+#if defined(EXCEPTION_POOL_HEAP_FIRST)
+  if (void* block = std::malloc(p_bytes)) {
+    return block;
+  }
+#endif
+  return claim(p_bytes);
+}
+
+void deallocate(void* p_block)
+{
+#if defined(EXCEPTION_POOL_HEAP_FIRST)
+  auto address = reinterpret_cast<std::uintptr_t>(p_block);
+  auto start = reinterpret_cast<std::uintptr_t>(arena.data());
+  if (address < start || address >= start + arena_size) {
+    std::free(p_block);
+    return;
+  }
+#endif
+  release(p_block);
+}
+}  // namespace
+
+statistics get_statistics()
+{
+  return {
+    .allocations = allocations.load(std::memory_order_relaxed),
+    .in_use = in_use.load(std::memory_order_relaxed),
+    .high_water_slots = high_water_slots.load(std::memory_order_relaxed),
+    .high_water_bytes = high_water_bytes.load(std::memory_order_relaxed),
+  };
+}
+
+void reset_statistics()
+{
+  allocations.store(0, std::memory_order_relaxed);
+  high_water_slots.store(in_use.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+  high_water_bytes.store(0, std::memory_order_relaxed);
+}
+}  // namespace exception_pool
+
+// Same contract as libstdc++'s eh_alloc.cc. The dependent exception pair is
+// replaced as well so that eh_alloc.o, and the emergency pool it carries, is
+// never pulled into a statically linked image.
+namespace __cxxabiv1 {
+extern "C" void* __cxa_allocate_exception(std::size_t p_thrown_size) noexcept
+{
+  using namespace exception_pool;
+  auto* block =
+    static_cast<std::byte*>(allocate(header_size + p_thrown_size));
+  std::memset(block, 0, header_size);
+  return block + header_size;
+}
+
+extern "C" void __cxa_free_exception(void* p_thrown_object) noexcept
+{
+  using namespace exception_pool;
+  deallocate(static_cast<std::byte*>(p_thrown_object) - header_size);
+}
+
+extern "C" __cxa_dependent_exception*
+__cxa_allocate_dependent_exception() noexcept
+{
+  // __cxa_dependent_exception is no larger than the refcounted header
+  void* block = exception_pool::allocate(exception_pool::header_size);
+  std::memset(block, 0, exception_pool::header_size);
+  return static_cast<__cxa_dependent_exception*>(block);
+}
+
+extern "C" void __cxa_free_dependent_exception(
+  __cxa_dependent_exception* p_exception) noexcept
+{
+  exception_pool::deallocate(p_exception);
+}
+}  // namespace __cxxabiv1
@@ -0,0 +1,119 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <unwind.h>
+
+// Replaces libstdc++'s heap backed exception allocation with a fixed arena.
+//
+// Linking exception_pool.cpp into a program overrides
+// __cxa_allocate_exception and friends, so every `throw` takes a slot from a
+// statically sized arena instead of calling malloc. Nothing is allocated
+// from the heap, so throwing is safe wherever taking a slot is safe,
+// including ISRs. If no slot is free, or the thrown object does not fit in a
+// slot, std::terminate() is called. libstdc++ does the same once both malloc
+// and its emergency pool are exhausted.
+//
+// Size the arena with these definitions:
+//
+//   EXCEPTION_POOL_SLOTS        exceptions that can be alive at once
+//   EXCEPTION_POOL_OBJECT_SIZE  largest thrown object in bytes
+//
+// With EXCEPTION_POOL_HEAP_FIRST defined, exceptions come from malloc and the
+// arena is only used once malloc fails. That is the policy of libstdc++'s
+// emergency pool, with the pool sized at compile time and kept in .bss, like
+// a libstdc++ configured with --enable-libstdcxx-static-eh-pool. Setting
+// EXCEPTION_POOL_SLOTS to 0 then leaves the emergency pool out altogether.
+
+#if !defined(EXCEPTION_POOL_SLOTS)
+#define EXCEPTION_POOL_SLOTS 2
+#endif
+
+#if !defined(EXCEPTION_POOL_OBJECT_SIZE)
+#define EXCEPTION_POOL_OBJECT_SIZE 256
+#endif
+
+namespace exception_pool {
+namespace detail {
+/// libstdc++'s __cxa_exception and __cxa_refcounted_exception, from
+/// libsupc++/unwind-cxx.h, which <cxxabi.h> does not declare. They assume the
+/// Itanium C++ ABI, or ARM EHABI where the unwinder defines
+/// __ARM_EABI_UNWINDER__, and an int sized _Atomic_word. Only their size and
+/// alignment are used.
+struct cxa_exception
+{
+  void* exception_type;
+  void (*exception_destructor)(void*);
+  void (*unexpected_handler)();
+  void (*terminate_handler)();
+  cxa_exception* next_exception;
+  int handler_count;
+#if defined(__ARM_EABI_UNWINDER__)
+  cxa_exception* next_propagating_exception;
+  int propagation_count;
+#else
+  int handler_switch_value;
+  const unsigned char* action_record;
+  const unsigned char* language_specific_data;
+  _Unwind_Ptr catch_temp;
+  void* adjusted_ptr;
+#endif
+  _Unwind_Exception unwind_header;
+};
+
+struct refcounted_exception
+{
+  int reference_count;
+  cxa_exception exception;
+};
+}  // namespace detail
+
+/// Thrown objects and headers are kept at this alignment
+constexpr std::size_t alignment = 16;
+/// Room left in front of each thrown object for the ABI's exception header.
+/// It is 128 bytes on both x86-64 and ARM EHABI. The runtime finds the header
+/// by stepping back from the thrown object.
+constexpr std::size_t header_size =
+  (sizeof(detail::refcounted_exception) + alignment - 1) / alignment *
+  alignment;
+static_assert(alignment % alignof(detail::refcounted_exception) == 0,
+              "The arena must keep the exception header aligned");
+
+constexpr std::size_t slots = EXCEPTION_POOL_SLOTS;
+constexpr std::size_t slot_size =
+  (header_size + EXCEPTION_POOL_OBJECT_SIZE + alignment - 1) / alignment *
+  alignment;
+constexpr std::size_t arena_size = slots * slot_size;
+
+struct statistics
+{
+  /// Slots handed out since the last reset
+  std::uint32_t allocations = 0;
+  /// Slots currently holding an exception
+  std::uint32_t in_use = 0;
+  /// Most slots held at once since the last reset
+  std::uint32_t high_water_slots = 0;
+  /// Largest request since the last reset, header included
+  std::size_t high_water_bytes = 0;
+};
+
+statistics get_statistics();
+
+/// Clears the counters and high water marks, `in_use` is kept
+void reset_statistics();
+}  // namespace exception_pool
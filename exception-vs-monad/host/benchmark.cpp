@@ -0,0 +1,285 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+
+#include <benchmark.hpp>
+
+namespace benchmark {
+namespace {
+// Makes the median absolute deviation comparable to a standard deviation for
+// normally distributed samples
+constexpr double mad_to_stddev = 1.4826;
+
+/// Linear interpolation between the closest ranks of sorted samples
+double percentile(const std::vector<double>& p_sorted, double p_fraction)
+{
+  if (p_sorted.empty()) {
+    return 0.0;
+  }
+  auto position = p_fraction * static_cast<double>(p_sorted.size() - 1);
+  auto lower = static_cast<std::size_t>(position);
+  auto upper = std::min(lower + 1, p_sorted.size() - 1);
+  auto weight = position - static_cast<double>(lower);
+  return p_sorted[lower] + (p_sorted[upper] - p_sorted[lower]) * weight;
+}
+
+void write_json_string(std::FILE* p_file, std::string_view p_text)
+{
+  std::fputc('"', p_file);
+  for (char character : p_text) {
+    if (character == '"' || character == '\\') {
+      std::fputc('\\', p_file);
+    }
+    std::fputc(character, p_file);
+  }
+  std::fputc('"', p_file);
+}
+}  // namespace
+
+statistics summarize(std::string p_name,
+                     std::uint64_t p_calls_per_trial,
+                     std::vector<double> p_samples,
+                     double p_outlier_cutoff,
+                     std::vector<double> p_single_calls)
+{
+  statistics result;
+  result.name = std::move(p_name);
+  result.calls_per_trial = p_calls_per_trial;
+  result.trials = p_samples.size();
+
+  if (p_samples.empty()) {
+    return result;
+  }
+
+  std::sort(p_samples.begin(), p_samples.end());
+
+  // Before any sample is rejected, the slow ones are the tail
+  std::sort(p_single_calls.begin(), p_single_calls.end());
+  result.tail_samples = p_single_calls.size();
+  const auto& tail = p_single_calls.empty() ? p_samples : p_single_calls;
+  result.p90 = percentile(tail, 0.90);
+  result.p99 = percentile(tail, 0.99);
+  result.max = tail.back();
+
+  if (p_outlier_cutoff > 0.0) {
+    auto median = percentile(p_samples, 0.5);
+    std::vector<double> deviations;
+    deviations.reserve(p_samples.size());
+    for (auto sample : p_samples) {
+      deviations.push_back(std::abs(sample - median));
+    }
+    std::sort(deviations.begin(), deviations.end());
+    auto spread = percentile(deviations, 0.5) * mad_to_stddev;
+
+    if (spread > 0.0) {
+      std::erase_if(p_samples, [&](double p_sample) {
+        return std::abs(p_sample - median) / spread > p_outlier_cutoff;
+      });
+    }
+  }
+
+  result.rejected = result.trials - p_samples.size();
+
+  auto sum = std::accumulate(p_samples.begin(), p_samples.end(), 0.0);
+  result.mean = sum / static_cast<double>(p_samples.size());
+
+  double squares = 0.0;
+  for (auto sample : p_samples) {
+    squares += (sample - result.mean) * (sample - result.mean);
+  }
+  result.stddev = std::sqrt(squares / static_cast<double>(p_samples.size()));
+
+  result.min = p_samples.front();
+  result.median = percentile(p_samples, 0.50);
+  return result;
+}
+
+double clock_overhead()
+{
+  static const double overhead = []() {
+    constexpr std::size_t reads = 1'001;
+    std::vector<double> samples;
+    samples.reserve(reads);
+    for (std::size_t i = 0; i < reads; i++) {
+      auto start = std::chrono::steady_clock::now();
+      auto stop = std::chrono::steady_clock::now();
+      std::chrono::duration<double, std::nano> elapsed = stop - start;
+      samples.push_back(elapsed.count());
+    }
+    std::sort(samples.begin(), samples.end());
+    return percentile(samples, 0.5);
+  }();
+  return overhead;
+}
+
+void add_event_counts(statistics& p_result,
+                      const event_counters& p_counters,
+                      std::uint64_t p_calls)
+{
+  auto counts = p_counters.read();
+  for (std::size_t i = 0; i < event_counters::event_count; i++) {
+    if (p_counters.available(i)) {
+      p_result.parameters.emplace_back(
+        std::string(event_counters::names[i]) + "_per_call",
+        counts[i] / static_cast<double>(p_calls));
+    }
+  }
+}
+
+void print(std::FILE* p_file,
+           std::string_view p_suite,
+           std::span<const statistics> p_results)
+{
+  for (const auto& result : p_results) {
+    std::string label = result.name;
+    for (const auto& [key, value] : result.parameters) {
+      char buffer[64];
+      std::snprintf(buffer, sizeof(buffer), " %s=%g", key.c_str(), value);
+      label += buffer;
+    }
+    std::fprintf(p_file,
+                 "%-20.*s %-32s median %10.2f  p90 %10.2f  p99 %10.2f  "
+                 "max %10.2f ns/call (%zu/%zu trials kept, %zu single "
+                 "calls)\n",
+                 static_cast<int>(p_suite.size()),
+                 p_suite.data(),
+                 label.c_str(),
+                 result.median,
+                 result.p90,
+                 result.p99,
+                 result.max,
+                 result.trials - result.rejected,
+                 result.trials,
+                 result.tail_samples);
+  }
+}
+
+void write_json(std::FILE* p_file,
+                std::string_view p_suite,
+                std::span<const statistics> p_results)
+{
+  std::fputs("{\n  \"suite\": ", p_file);
+  write_json_string(p_file, p_suite);
+  std::fputs(",\n  \"results\": [", p_file);
+
+  const char* separator = "\n";
+  for (const auto& result : p_results) {
+    std::fputs(separator, p_file);
+    separator = ",\n";
+
+    std::fputs("    {\"name\": ", p_file);
+    write_json_string(p_file, result.name);
+    for (const auto& [key, value] : result.parameters) {
+      std::fputs(", ", p_file);
+      write_json_string(p_file, key);
+      std::fprintf(p_file, ": %.10g", value);
+    }
+    std::fprintf(p_file,
+                 ", \"calls_per_trial\": %llu, \"trials\": %zu, "
+                 "\"rejected\": %zu, \"tail_samples\": %zu, "
+                 "\"mean_ns\": %.4f, \"stddev_ns\": %.4f, "
+                 "\"min_ns\": %.4f, \"median_ns\": %.4f, \"p90_ns\": %.4f, "
+                 "\"p99_ns\": %.4f, \"max_ns\": %.4f}",
+                 static_cast<unsigned long long>(result.calls_per_trial),
+                 result.trials,
+                 result.rejected,
+                 result.tail_samples,
+                 result.mean,
+                 result.stddev,
+                 result.min,
+                 result.median,
+                 result.p90,
+                 result.p99,
+                 result.max);
+  }
+  std::fputs("\n  ]\n}\n", p_file);
+}
+
+bool parse_options(int p_argc,
+                   char* p_argv[],
+                   common_options& p_options,
+                   std::span<settings* const> p_more,
+                   bool (*p_other)(const char*, const char*, void*),
+                   void* p_context)
+{
+  std::vector<settings*> all = { &p_options.happy, &p_options.error };
+  all.insert(all.end(), p_more.begin(), p_more.end());
+
+  for (int i = 1; i + 1 < p_argc; i += 2) {
+    const char* name = p_argv[i];
+    const char* value = p_argv[i + 1];
+    auto number = std::strtoull(value, nullptr, 10);
+    if (std::strcmp(name, "--happy-iterations") == 0) {
+      p_options.happy.calls_per_trial = number;
+    } else if (std::strcmp(name, "--error-iterations") == 0) {
+      p_options.error.calls_per_trial = number;
+    } else if (std::strcmp(name, "--trials") == 0) {
+      for (auto* settings : all) {
+        settings->trials = static_cast<std::uint32_t>(number);
+      }
+    } else if (std::strcmp(name, "--warmup-trials") == 0) {
+      for (auto* settings : all) {
+        settings->warmup_trials = static_cast<std::uint32_t>(number);
+      }
+    } else if (std::strcmp(name, "--outlier-cutoff") == 0) {
+      for (auto* settings : all) {
+        settings->outlier_cutoff = std::strtod(value, nullptr);
+      }
+    } else if (std::strcmp(name, "--tail-samples") == 0) {
+      for (auto* settings : all) {
+        settings->tail_samples = static_cast<std::uint32_t>(number);
+      }
+    } else if (std::strcmp(name, "--json") == 0) {
+      p_options.json_path = value;
+    } else if (!p_other(name, value, p_context)) {
+      return false;
+    }
+  }
+
+  for (auto* settings : all) {
+    if (settings->calls_per_trial == 0 || settings->trials == 0) {
+      return false;
+    }
+  }
+  return p_argc % 2 == 1;
+}
+
+bool write_results(const char* p_json_path,
+                   std::string_view p_suite,
+                   std::span<const statistics> p_results)
+{
+  auto* summary = stdout;
+  if (p_json_path != nullptr) {
+    if (std::strcmp(p_json_path, "-") == 0) {
+      write_json(stdout, p_suite, p_results);
+      summary = stderr;
+    } else if (auto* file = std::fopen(p_json_path, "w")) {
+      write_json(file, p_suite, p_results);
+      std::fclose(file);
+    } else {
+      std::perror(p_json_path);
+      return false;
+    }
+  }
+
+  print(summary, p_suite, p_results);
+  return true;
+}
+}  // namespace benchmark
@@ -0,0 +1,204 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <event_counters.hpp>
+
+// Small statistical benchmark runner shared by the host builds of every
+// exception-vs-monad variant.
+//
+// A measurement is a number of trials. Each trial times a batch of calls and
+// yields one sample in nanoseconds per call. Warmup trials are run first and
+// discarded. Samples far from the median are rejected as outliers before the
+// mean and median are computed, so a single preempted trial does not move
+// them. The tail is a different question, so it comes from single calls,
+// each timed on its own after the trials, and none of those are rejected.
+namespace benchmark {
+struct settings
+{
+  /// Trials run before measuring and thrown away
+  std::uint32_t warmup_trials = 1;
+  /// Timed trials, each one is one sample
+  std::uint32_t trials = 30;
+  /// Calls timed together in one trial to amortize reading the clock
+  std::uint64_t calls_per_trial = 10'000;
+  /// Samples more than this many scaled median absolute deviations away from
+  /// the median are rejected. Zero or less keeps every sample.
+  double outlier_cutoff = 3.5;
+  /// Calls timed one at a time after the trials for p90, p99 and max. With
+  /// none, those are taken over every trial's sample instead.
+  std::uint32_t tail_samples = 2'000;
+  /// When set, hardware events are counted over the timed trials and added
+  /// to the results as per call averages, e.g. "instructions_per_call"
+  event_counters* counters = nullptr;
+};
+
+struct statistics
+{
+  std::string name;
+  /// Extra numbers describing the measurement, written out with the results
+  std::vector<std::pair<std::string, double>> parameters;
+  std::uint64_t calls_per_trial = 0;
+  std::size_t trials = 0;
+  std::size_t rejected = 0;
+  std::size_t tail_samples = 0;
+  // All in nanoseconds per call, over the trials that were kept
+  double mean = 0.0;
+  double stddev = 0.0;
+  double min = 0.0;
+  double median = 0.0;
+  // Over the single call samples, or over every trial when there are none
+  double p90 = 0.0;
+  double p99 = 0.0;
+  double max = 0.0;
+};
+
+/// Rejects outliers from per trial samples and reduces the rest. The tail
+/// percentiles come from p_single_calls when there are any.
+statistics summarize(std::string p_name,
+                     std::uint64_t p_calls_per_trial,
+                     std::vector<double> p_samples,
+                     double p_outlier_cutoff,
+                     std::vector<double> p_single_calls = {});
+
+/// Nanoseconds that reading the clock before and after a call adds to it
+double clock_overhead();
+
+/// Times p_count calls of p_body one by one, less the clock's own overhead
+template<typename Body>
+std::vector<double> time_single_calls(std::uint32_t p_count, Body&& p_body)
+{
+  auto overhead = clock_overhead();
+  std::vector<double> samples;
+  samples.reserve(p_count);
+  for (std::uint32_t i = 0; i < p_count; i++) {
+    auto start = std::chrono::steady_clock::now();
+    p_body();
+    auto stop = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::nano> elapsed = stop - start;
+    samples.push_back(std::max(0.0, elapsed.count() - overhead));
+  }
+  return samples;
+}
+
+/// Adds the per call average of every available event to p_result
+void add_event_counts(statistics& p_result,
+                      const event_counters& p_counters,
+                      std::uint64_t p_calls);
+
+/// Runs p_body p_settings.calls_per_trial times per trial
+template<typename Body>
+statistics measure(std::string p_name,
+                   const settings& p_settings,
+                   Body&& p_body)
+{
+  for (std::uint32_t trial = 0; trial < p_settings.warmup_trials; trial++) {
+    for (std::uint64_t i = 0; i < p_settings.calls_per_trial; i++) {
+      p_body();
+    }
+  }
+
+  auto* counters = p_settings.counters;
+  if (counters != nullptr) {
+    counters->reset();
+  }
+
+  std::vector<double> samples;
+  samples.reserve(p_settings.trials);
+  for (std::uint32_t trial = 0; trial < p_settings.trials; trial++) {
+    if (counters != nullptr) {
+      counters->start();
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 0; i < p_settings.calls_per_trial; i++) {
+      p_body();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    if (counters != nullptr) {
+      counters->stop();
+    }
+
+    std::chrono::duration<double, std::nano> elapsed = stop - start;
+    samples.push_back(elapsed.count() /
+                      static_cast<double>(p_settings.calls_per_trial));
+  }
+
+  // Outside the counted trials, so the counts stay per batched call
+  auto single_calls = time_single_calls(p_settings.tail_samples, p_body);
+
+  auto result = summarize(std::move(p_name),
+                          p_settings.calls_per_trial,
+                          std::move(samples),
+                          p_settings.outlier_cutoff,
+                          std::move(single_calls));
+  if (counters != nullptr) {
+    add_event_counts(
+      result, *counters, p_settings.calls_per_trial * p_settings.trials);
+  }
+  return result;
+}
+
+/// Prints one human readable line per result
+void print(std::FILE* p_file,
+           std::string_view p_suite,
+           std::span<const statistics> p_results);
+
+/// Writes the results as one JSON object: {"suite": ..., "results": [...]}
+void write_json(std::FILE* p_file,
+                std::string_view p_suite,
+                std::span<const statistics> p_results);
+
+/// Command line options every host driver takes
+struct common_options
+{
+  settings happy{ .calls_per_trial = 100'000 };
+  settings error{ .calls_per_trial = 10'000 };
+  /// Where write_results() writes JSON, "-" for stdout, nullptr for nowhere
+  const char* json_path = nullptr;
+};
+
+/// Parses "--name value" pairs
+///
+/// --happy-iterations, --error-iterations and --json go to p_options.
+/// --trials, --warmup-trials, --outlier-cutoff and --tail-samples go to its
+/// happy and error settings and to every one in p_more. Any other option is handed to
+/// p_other(name, value, p_context), which returns whether it knew it. Returns
+/// false for an unknown option, a name without a value, or settings without
+/// calls or trials.
+bool parse_options(int p_argc,
+                   char* p_argv[],
+                   common_options& p_options,
+                   std::span<settings* const> p_more,
+                   bool (*p_other)(const char*, const char*, void*),
+                   void* p_context);
+
+/// Prints the results, and writes them as JSON to p_json_path if it is set.
+/// With "-" the JSON goes to stdout and the summary to stderr. Returns false
+/// if the JSON file could not be opened.
+bool write_results(const char* p_json_path,
+                   std::string_view p_suite,
+                   std::span<const statistics> p_results);
+}  // namespace benchmark
@@ -0,0 +1,126 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+
+#include <link.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cold_start.hpp>
+
+extern char** environ;
+
+namespace benchmark {
+namespace {
+std::size_t cache_line_size()
+{
+#if defined(__aarch64__)
+  // CTR_EL0.DminLine is log2 of the smallest data cache line in words
+  std::uint64_t cache_type = 0;
+  asm volatile("mrs %0, ctr_el0" : "=r"(cache_type));
+  return std::size_t{ 4 } << ((cache_type >> 16) & 0xF);
+#else
+  return 64;
+#endif
+}
+
+void flush_line([[maybe_unused]] const void* p_address)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_clflush(p_address);
+#elif defined(__aarch64__)
+  asm volatile("dc civac, %0" : : "r"(p_address) : "memory");
+#endif
+}
+
+int flush_image(dl_phdr_info* p_info, std::size_t, void* p_line_size)
+{
+  auto line_size = *static_cast<std::size_t*>(p_line_size);
+  for (int i = 0; i < p_info->dlpi_phnum; i++) {
+    const auto& header = p_info->dlpi_phdr[i];
+    if (header.p_type != PT_LOAD || (header.p_flags & PF_R) == 0) {
+      continue;
+    }
+    auto start = p_info->dlpi_addr + header.p_vaddr;
+    auto end = start + header.p_memsz;
+    for (auto line = start & ~(line_size - 1); line < end;
+         line += line_size) {
+      flush_line(reinterpret_cast<const void*>(line));
+    }
+  }
+  return 0;
+}
+}  // namespace
+
+void flush_loaded_images()
+{
+  auto line_size = cache_line_size();
+  dl_iterate_phdr(flush_image, &line_size);
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_mfence();
+#elif defined(__aarch64__)
+  asm volatile("dsb sy\n\tisb" ::: "memory");
+#endif
+}
+
+std::optional<std::string> run_fresh_process(
+  const char* p_path,
+  const std::vector<const char*>& p_arguments)
+{
+  int output[2];
+  if (pipe(output) != 0) {
+    return std::nullopt;
+  }
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_adddup2(&actions, output[1], STDOUT_FILENO);
+  posix_spawn_file_actions_addclose(&actions, output[0]);
+
+  std::vector<char*> arguments;
+  arguments.push_back(const_cast<char*>(p_path));
+  for (const auto* argument : p_arguments) {
+    arguments.push_back(const_cast<char*>(argument));
+  }
+  arguments.push_back(nullptr);
+
+  pid_t child = 0;
+  auto error = posix_spawn(
+    &child, p_path, &actions, nullptr, arguments.data(), environ);
+  posix_spawn_file_actions_destroy(&actions);
+  close(output[1]);
+  if (error != 0) {
+    close(output[0]);
+    return std::nullopt;
+  }
+
+  std::string text;
+  char buffer[256];
+  ssize_t count = 0;
+  while ((count = read(output[0], buffer, sizeof(buffer))) > 0) {
+    text.append(buffer, static_cast<std::size_t>(count));
+  }
+  close(output[0]);
+
+  int status = 0;
+  if (waitpid(child, &status, 0) != child || !WIFEXITED(status) ||
+      WEXITSTATUS(status) != 0) {
+    return std::nullopt;
+  }
+  return text;
+}
+}  // namespace benchmark
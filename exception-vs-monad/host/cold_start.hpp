@@ -0,0 +1,39 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+// Helpers for timing the first call of a path, before anything is warm.
+//
+// A device hits its first error long after boot, with cold caches and with an
+// unwinder that has never looked at its tables. In a process that already
+// threw, the unwinder's caches, the lazily bound library calls and the CPU
+// caches all hide that cost. Each cold sample therefore comes from a new
+// process that evicts its own code and data from the caches first.
+namespace benchmark {
+/// Writes back and evicts every loaded segment of the program and its shared
+/// libraries (code, unwind tables, data) from the CPU caches. Does nothing on
+/// architectures without a user space cache flush.
+void flush_loaded_images();
+
+/// Runs the program at p_path with p_arguments in a new process and returns
+/// what it wrote to stdout, or nothing if it could not run or failed
+std::optional<std::string> run_fresh_process(
+  const char* p_path,
+  const std::vector<const char*>& p_arguments);
+}  // namespace benchmark
@@ -0,0 +1,380 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark.hpp>
+#include <cold_start.hpp>
+#include <harness.hpp>
+#include <heap.hpp>
+#include <stack_usage.hpp>
+
+#if defined(EXCEPTION_POOL)
+#include "../exception_pool/exception_pool.hpp"
+#endif
+
+#if defined(HOST_BENCHMARK_COROUTINES)
+#include <coroutine_result.hpp>
+#endif
+
+namespace harness {
+std::uint32_t depth_before_exception =
+  std::numeric_limits<std::uint32_t>::max();
+}  // namespace harness
+
+namespace {
+constexpr std::uint32_t never_fail = std::numeric_limits<std::uint32_t>::max();
+
+// Decisions for the mixed runs are drawn ahead of time and replayed so that
+// the random number generator stays out of the timed loop.
+constexpr std::size_t decision_count = 1 << 16;
+
+struct options
+{
+  benchmark::common_options common;
+  benchmark::settings mixed{ .calls_per_trial = 10'000 };
+  std::vector<double> failure_rates = { 0.0, 0.001, 0.01, 0.1, 0.5 };
+  std::uint64_t seed = 1;
+  /// Fresh processes per path for the first call measurements
+  std::uint32_t cold_trials = 10;
+  /// Error path calls made with the heap exhausted, 0 to skip them
+  std::uint32_t exhausted_calls = 0;
+  bool count_events = false;
+};
+
+volatile int sink = 0;
+
+void call_once(void*)
+{
+  sink = harness::call_top();
+}
+
+/// Records the size of the variant's error and of what its frames return
+void add_layout(benchmark::statistics& p_result)
+{
+  p_result.parameters.emplace_back("error_bytes", harness::layout.error_bytes);
+  p_result.parameters.emplace_back("result_bytes",
+                                   harness::layout.result_bytes);
+  p_result.parameters.emplace_back("result_trivial_for_calls",
+                                   harness::layout.result_trivial_for_calls);
+}
+
+/// Records how much of the static exception pool a measurement used
+void add_pool_usage([[maybe_unused]] benchmark::statistics& p_result)
+{
+#if defined(EXCEPTION_POOL)
+  auto usage = exception_pool::get_statistics();
+  p_result.parameters.emplace_back("pool_arena_bytes",
+                                   exception_pool::arena_size);
+  p_result.parameters.emplace_back("pool_high_water_slots",
+                                   usage.high_water_slots);
+  p_result.parameters.emplace_back("pool_high_water_bytes",
+                                   usage.high_water_bytes);
+  exception_pool::reset_statistics();
+#endif
+}
+
+/// Records the coroutine frames one call of the current path allocates
+void add_frame_usage([[maybe_unused]] benchmark::statistics& p_result)
+{
+#if defined(HOST_BENCHMARK_COROUTINES)
+  coro::reset_frame_statistics();
+  call_once(nullptr);
+  auto usage = coro::get_frame_statistics();
+  p_result.parameters.emplace_back("frames_per_call", usage.allocations);
+  p_result.parameters.emplace_back("frame_bytes_per_call",
+                                   usage.allocated_bytes);
+  p_result.parameters.emplace_back("frame_high_water_bytes",
+                                   usage.high_water_bytes);
+  p_result.parameters.emplace_back("largest_frame_bytes",
+                                   usage.largest_frame_bytes);
+#endif
+}
+
+benchmark::statistics measure_path(const char* p_name,
+                                   std::uint32_t p_threshold,
+                                   const benchmark::settings& p_settings)
+{
+  harness::depth_before_exception = p_threshold;
+  auto result = benchmark::measure(
+    p_name, p_settings, []() { sink = harness::call_top(); });
+  result.parameters.emplace_back(
+    "peak_stack_bytes", benchmark::peak_stack_usage(call_once, nullptr));
+  add_layout(result);
+  add_pool_usage(result);
+  add_frame_usage(result);
+  return result;
+}
+
+benchmark::statistics measure_mixed(double p_failure_rate,
+                                    std::uint64_t p_seed,
+                                    const benchmark::settings& p_settings)
+{
+  std::mt19937_64 generator(p_seed);
+  std::bernoulli_distribution should_fail(p_failure_rate);
+  std::vector<std::uint32_t> thresholds(decision_count);
+  std::uint64_t failures = 0;
+  for (auto& threshold : thresholds) {
+    threshold =
+      should_fail(generator) ? harness::failing_threshold : never_fail;
+    failures += threshold != never_fail;
+  }
+
+  std::size_t index = 0;
+  auto result = benchmark::measure("mixed", p_settings, [&]() {
+    harness::depth_before_exception = thresholds[index];
+    index = (index + 1) % decision_count;
+    sink = harness::call_top();
+  });
+
+  result.parameters = {
+    { "failure_rate", p_failure_rate },
+    { "realized_failure_rate",
+      static_cast<double>(failures) / static_cast<double>(decision_count) },
+    { "seed", static_cast<double>(p_seed) },
+  };
+  add_layout(result);
+  add_pool_usage(result);
+  return result;
+}
+
+/// Child side of measure_cold(). Runs in a process that has not called
+/// top_call() yet, evicts the caches and prints how long the first and the
+/// second call took, in nanoseconds.
+int run_cold_start(const char* p_path)
+{
+  bool error = std::strcmp(p_path, "error") == 0;
+  harness::depth_before_exception =
+    error ? harness::failing_threshold : never_fail;
+
+  // Read the clock once so that its own first call is not part of the time
+  [[maybe_unused]] auto unused = std::chrono::steady_clock::now();
+  benchmark::flush_loaded_images();
+
+  auto start = std::chrono::steady_clock::now();
+  sink = harness::call_top();
+  auto first = std::chrono::steady_clock::now();
+  sink = harness::call_top();
+  auto second = std::chrono::steady_clock::now();
+
+  std::chrono::duration<double, std::nano> first_call = first - start;
+  std::chrono::duration<double, std::nano> second_call = second - first;
+  std::printf("%.1f %.1f\n", first_call.count(), second_call.count());
+  return EXIT_SUCCESS;
+}
+
+/// Times the first call of a path, each sample in a new process. Every
+/// sample is kept, since the slow ones are what this is looking for.
+std::optional<benchmark::statistics> measure_cold(const char* p_path,
+                                                  std::uint32_t p_trials)
+{
+  std::vector<double> first_calls;
+  std::vector<double> second_calls;
+  for (std::uint32_t trial = 0; trial < p_trials; trial++) {
+    auto output = benchmark::run_fresh_process("/proc/self/exe",
+                                               { "--cold-start", p_path });
+    double first_call = 0.0;
+    double second_call = 0.0;
+    if (!output || std::sscanf(output->c_str(),
+                               "%lf %lf",
+                               &first_call,
+                               &second_call) != 2) {
+      return std::nullopt;
+    }
+    first_calls.push_back(first_call);
+    second_calls.push_back(second_call);
+  }
+
+  auto result = benchmark::summarize(
+    std::string(p_path) + "_first", 1, std::move(first_calls), 0.0);
+  auto second = benchmark::summarize("second", 1, std::move(second_calls), 0.0);
+  result.parameters.emplace_back("second_call_median_ns", second.median);
+  add_layout(result);
+  return result;
+}
+
+/// Child side of measure_exhausted(). Takes every byte malloc has left, then
+/// times p_calls calls down the error path and prints one sample per line, in
+/// nanoseconds. A throw that finds no memory calls std::terminate() instead.
+int run_exhausted_heap(std::uint32_t p_calls)
+{
+  harness::depth_before_exception = harness::failing_threshold;
+  std::vector<double> samples(p_calls);
+  {
+    benchmark::heap_exhaustion exhaustion;
+    for (auto& sample : samples) {
+      auto start = std::chrono::steady_clock::now();
+      sink = harness::call_top();
+      std::chrono::duration<double, std::nano> call =
+        std::chrono::steady_clock::now() - start;
+      sample = call.count();
+    }
+  }
+  for (auto sample : samples) {
+    std::printf("%.1f\n", sample);
+  }
+  return EXIT_SUCCESS;
+}
+
+/// Times the error path in a new process whose heap is exhausted, so that
+/// every throw has to come from the emergency pool. The result has no samples
+/// and throws_without_heap is 0 if the process did not survive its throws.
+benchmark::statistics measure_exhausted(std::uint32_t p_calls,
+                                        std::size_t p_startup_heap)
+{
+  auto calls = std::to_string(p_calls);
+  auto output = benchmark::run_fresh_process(
+    "/proc/self/exe", { "--exhausted-heap", calls.c_str() });
+
+  std::vector<double> samples;
+  if (output) {
+    char* end = nullptr;
+    for (const char* cursor = output->c_str();; cursor = end) {
+      auto sample = std::strtod(cursor, &end);
+      if (end == cursor) {
+        break;
+      }
+      samples.push_back(sample);
+    }
+  }
+
+  auto result =
+    benchmark::summarize("error_exhausted", 1, std::move(samples), 0.0);
+  result.parameters.emplace_back("throws_without_heap",
+                                 output.has_value() ? 1 : 0);
+  result.parameters.emplace_back("startup_heap_bytes", p_startup_heap);
+  add_pool_usage(result);
+  return result;
+}
+
+std::vector<double> parse_rates(const char* p_text)
+{
+  std::vector<double> rates;
+  char* end = nullptr;
+  for (const char* cursor = p_text; *cursor != '\0'; cursor = end) {
+    rates.push_back(std::strtod(cursor, &end));
+    if (end == cursor) {
+      return {};
+    }
+    if (*end == ',') {
+      end++;
+    }
+  }
+  return rates;
+}
+
+/// The driver's own options, for benchmark::parse_options()
+bool parse_option(const char* p_name, const char* p_value, void* p_options)
+{
+  auto& options = *static_cast<struct options*>(p_options);
+  auto number = std::strtoull(p_value, nullptr, 10);
+  if (std::strcmp(p_name, "--mixed-iterations") == 0) {
+    options.mixed.calls_per_trial = number;
+  } else if (std::strcmp(p_name, "--failure-rates") == 0) {
+    options.failure_rates = parse_rates(p_value);
+  } else if (std::strcmp(p_name, "--seed") == 0) {
+    options.seed = number;
+  } else if (std::strcmp(p_name, "--cold-trials") == 0) {
+    options.cold_trials = static_cast<std::uint32_t>(number);
+  } else if (std::strcmp(p_name, "--exhausted-calls") == 0) {
+    options.exhausted_calls = static_cast<std::uint32_t>(number);
+  } else if (std::strcmp(p_name, "--counters") == 0) {
+    options.count_events = std::strcmp(p_value, "on") == 0;
+  } else {
+    return false;
+  }
+  return true;
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  // Before anything here allocates, so this is what static constructors took
+  auto startup_heap = benchmark::heap_in_use();
+
+  if (argc == 3 && std::strcmp(argv[1], "--cold-start") == 0) {
+    return run_cold_start(argv[2]);
+  }
+  if (argc == 3 && std::strcmp(argv[1], "--exhausted-heap") == 0) {
+    return run_exhausted_heap(
+      static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10)));
+  }
+
+  options options;
+  benchmark::settings* more[] = { &options.mixed };
+  if (!benchmark::parse_options(
+        argc, argv, options.common, more, parse_option, &options)) {
+    std::fprintf(
+      stderr,
+      "usage: %s [--happy-iterations N] [--error-iterations N]\n"
+      "       [--mixed-iterations N] [--trials N] [--warmup-trials N]\n"
+      "       [--outlier-cutoff X] [--tail-samples N]\n"
+      "       [--failure-rates p,p,...] [--seed N] [--cold-trials N]\n"
+      "       [--exhausted-calls N] [--json FILE|-] [--counters on|off]\n"
+      "Iterations are calls per trial.\n",
+      argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  benchmark::event_counters counters;
+  if (options.count_events) {
+    if (counters.available()) {
+      for (auto* settings :
+           { &options.common.happy, &options.common.error, &options.mixed }) {
+        settings->counters = &counters;
+      }
+    } else {
+      std::fprintf(stderr,
+                   "Hardware counters are not available, check "
+                   "/proc/sys/kernel/perf_event_paranoid\n");
+    }
+  }
+
+  std::vector<benchmark::statistics> results;
+  results.push_back(measure_path("happy", never_fail, options.common.happy));
+  results.push_back(
+    measure_path("error", harness::failing_threshold, options.common.error));
+  for (const char* path : { "happy", "error" }) {
+    if (options.cold_trials == 0) {
+      break;
+    }
+    if (auto result = measure_cold(path, options.cold_trials)) {
+      results.push_back(std::move(*result));
+    } else {
+      std::fprintf(stderr, "Could not measure the first %s call\n", path);
+    }
+  }
+  if (options.exhausted_calls > 0) {
+    results.push_back(
+      measure_exhausted(options.exhausted_calls, startup_heap));
+  }
+  for (auto rate : options.failure_rates) {
+    results.push_back(measure_mixed(rate, options.seed, options.mixed));
+  }
+
+  if (!benchmark::write_results(
+        options.common.json_path, HOST_BENCHMARK_VARIANT, results)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,170 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <event_counters.hpp>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace benchmark {
+#if defined(__linux__)
+namespace {
+constexpr std::uint64_t cache_read_miss(std::uint64_t p_cache)
+{
+  return p_cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+struct event
+{
+  std::uint32_t type;
+  std::uint64_t config;
+};
+
+// Same order as event_counters::names
+constexpr std::array<event, event_counters::event_count> events = { {
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+  { PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_L1D) },
+  { PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_L1I) },
+} };
+
+int open_event(const event& p_event)
+{
+  perf_event_attr attributes;
+  std::memset(&attributes, 0, sizeof(attributes));
+  attributes.size = sizeof(attributes);
+  attributes.type = p_event.type;
+  attributes.config = p_event.config;
+  attributes.disabled = 1;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  attributes.read_format =
+    PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  return static_cast<int>(
+    syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+}
+}  // namespace
+
+event_counters::event_counters()
+{
+  for (std::size_t i = 0; i < event_count; i++) {
+    m_descriptors[i] = open_event(events[i]);
+  }
+}
+
+event_counters::~event_counters()
+{
+  for (auto descriptor : m_descriptors) {
+    if (descriptor >= 0) {
+      close(descriptor);
+    }
+  }
+}
+
+void event_counters::reset()
+{
+  for (auto descriptor : m_descriptors) {
+    if (descriptor >= 0) {
+      ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+    }
+  }
+}
+
+void event_counters::start()
+{
+  for (auto descriptor : m_descriptors) {
+    if (descriptor >= 0) {
+      ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+}
+
+void event_counters::stop()
+{
+  for (auto descriptor : m_descriptors) {
+    if (descriptor >= 0) {
+      ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+}
+
+std::array<double, event_counters::event_count> event_counters::read() const
+{
+  std::array<double, event_count> counts{};
+  for (std::size_t i = 0; i < event_count; i++) {
+    // value, time_enabled, time_running
+    std::uint64_t values[3] = {};
+    if (m_descriptors[i] < 0 ||
+        ::read(m_descriptors[i], values, sizeof(values)) !=
+          static_cast<ssize_t>(sizeof(values)) ||
+        values[2] == 0) {
+      continue;
+    }
+    counts[i] = static_cast<double>(values[0]) *
+                static_cast<double>(values[1]) /
+                static_cast<double>(values[2]);
+  }
+  return counts;
+}
+#else
+event_counters::event_counters()
+{
+  m_descriptors.fill(-1);
+}
+
+event_counters::~event_counters() = default;
+
+void event_counters::reset()
+{
+}
+
+void event_counters::start()
+{
+}
+
+void event_counters::stop()
+{
+}
+
+std::array<double, event_counters::event_count> event_counters::read() const
+{
+  return {};
+}
+#endif
+
+bool event_counters::available() const
+{
+  for (std::size_t i = 0; i < event_count; i++) {
+    if (available(i)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool event_counters::available(std::size_t p_index) const
+{
+  return m_descriptors[p_index] >= 0;
+}
+}  // namespace benchmark
@@ -0,0 +1,62 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace benchmark {
+/// Hardware performance counters for the calling thread, via perf_event_open
+///
+/// Each event is opened on its own so that an event the CPU or kernel does
+/// not support only drops that one column. Counts are scaled by the time the
+/// event was actually scheduled, in case the kernel had to multiplex them.
+/// Only user space is counted. On anything other than Linux, or when
+/// perf_event_paranoid forbids it, no event is available and all counts read
+/// as zero.
+class event_counters
+{
+public:
+  static constexpr std::size_t event_count = 6;
+  static constexpr std::array<std::string_view, event_count> names = {
+    "cycles",        "instructions",    "branches",
+    "branch_misses", "l1d_read_misses", "l1i_read_misses",
+  };
+
+  event_counters();
+  ~event_counters();
+
+  event_counters(const event_counters&) = delete;
+  event_counters& operator=(const event_counters&) = delete;
+
+  /// True if at least one event could be opened
+  bool available() const;
+  /// True if the event at p_index could be opened
+  bool available(std::size_t p_index) const;
+
+  /// Zeroes every counter
+  void reset();
+  /// Starts counting, counts accumulate over start() and stop() pairs
+  void start();
+  void stop();
+
+  /// Scaled counts since the last reset()
+  std::array<double, event_count> read() const;
+
+private:
+  std::array<int, event_count> m_descriptors;
+};
+}  // namespace benchmark
@@ -0,0 +1,76 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Storage class for a variant's fake registers and side effects. The thread
+// driver makes them thread_local so threads do not share those cache lines.
+#if defined(HOST_BENCHMARK_THREADS)
+#define HARNESS_STATE thread_local
+#else
+#define HARNESS_STATE
+#endif
+
+// Contract between the host driver and each exception-vs-monad variant.
+//
+// When a variant's main.cpp is compiled with HOST_BENCHMARK defined, it swaps
+// its compile time `depth_before_exception` for the runtime value below and
+// exposes the body of its main() as `harness::call_top()`. The driver then
+// owns main() and can run the same code down either path.
+namespace harness {
+/// Channels at or above this value raise an error. Owned by the driver.
+extern std::uint32_t depth_before_exception;
+
+/// Value of `depth_before_exception` that makes top_call() fail at the
+/// deepest frame the variant has. Defined by the variant.
+extern const std::uint32_t failing_threshold;
+
+/// Shape of the error a variant raises and of what each frame returns.
+/// Whether the result comes back in registers follows from these and the
+/// target's calling convention.
+struct result_layout
+{
+  std::size_t error_bytes;
+  std::size_t result_bytes;
+  /// Itanium C++ ABI "trivial for the purposes of calls": only these can
+  /// be returned in registers. Unlike std::is_trivially_copyable, this
+  /// ignores assignment, which std::expected does not make trivial.
+  bool result_trivial_for_calls;
+};
+
+template<typename error, typename result>
+constexpr result_layout describe()
+{
+  return {
+    .error_bytes = sizeof(error),
+    .result_bytes = sizeof(result),
+    .result_trivial_for_calls =
+      std::is_trivially_destructible_v<result> &&
+      (std::is_trivially_copy_constructible_v<result> ||
+       std::is_trivially_move_constructible_v<result>),
+  };
+}
+
+/// Layout of the variant's error_t and of top_call()'s return type, set with
+/// describe(). Defined by the variant.
+extern const result_layout layout;
+
+/// Calls top_call() and folds the outcome into an int exactly as the
+/// variant's main() does on the device. Defined by the variant.
+int call_top();
+}  // namespace harness
@@ -0,0 +1,60 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdlib>
+
+#include <malloc.h>
+
+#include <heap.hpp>
+
+namespace benchmark {
+std::size_t heap_in_use()
+{
+#if defined(__GLIBC__)
+  return mallinfo2().uordblks;
+#else
+  return 0;
+#endif
+}
+
+heap_exhaustion::heap_exhaustion()
+{
+  getrlimit(RLIMIT_DATA, &m_data_limit);
+  // Linux lets mappings through when the soft limit is exactly 0
+  rlimit no_growth = m_data_limit;
+  no_growth.rlim_cur = 1;
+  setrlimit(RLIMIT_DATA, &no_growth);
+
+  // Largest blocks first, down to the smallest that holds the link, so that
+  // what is left in the free lists is taken too
+  for (std::size_t size = std::size_t{ 1 } << 20; size >= sizeof(void*);
+       size /= 2) {
+    while (void* block = std::malloc(size)) {
+      *static_cast<void**>(block) = m_blocks;
+      m_blocks = block;
+      m_taken_bytes += size;
+    }
+  }
+}
+
+heap_exhaustion::~heap_exhaustion()
+{
+  while (m_blocks != nullptr) {
+    void* next = *static_cast<void**>(m_blocks);
+    std::free(m_blocks);
+    m_blocks = next;
+  }
+  setrlimit(RLIMIT_DATA, &m_data_limit);
+}
+}  // namespace benchmark
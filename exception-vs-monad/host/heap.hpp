@@ -0,0 +1,57 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+
+#include <sys/resource.h>
+
+// Helpers for measuring what throwing needs from the heap.
+//
+// libstdc++ allocates thrown exceptions with malloc and only falls back to its
+// emergency pool when malloc fails. On a board whose heap is full, the pool is
+// all that is left, and its size decides whether a throw works at all.
+namespace benchmark {
+/// Bytes taken from malloc and not freed yet, 0 where the C library cannot
+/// tell. At the start of main() this is what static constructors allocated,
+/// such as libstdc++'s emergency pool.
+std::size_t heap_in_use();
+
+/// Takes every block malloc can still hand out, until destroyed
+///
+/// The data segment limit is lowered first, so that the heap cannot grow.
+/// While this is alive, only memory set aside beforehand can be allocated.
+class heap_exhaustion
+{
+public:
+  heap_exhaustion();
+  ~heap_exhaustion();
+
+  heap_exhaustion(const heap_exhaustion&) = delete;
+  heap_exhaustion& operator=(const heap_exhaustion&) = delete;
+
+  /// Bytes that had to be taken
+  std::size_t taken_bytes() const
+  {
+    return m_taken_bytes;
+  }
+
+private:
+  /// Taken blocks, each holding a pointer to the one taken before it
+  void* m_blocks = nullptr;
+  std::size_t m_taken_bytes = 0;
+  rlimit m_data_limit{};
+};
+}  // namespace benchmark
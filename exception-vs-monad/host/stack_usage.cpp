@@ -0,0 +1,102 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include <pthread.h>
+
+#include <stack_usage.hpp>
+
+namespace benchmark {
+namespace {
+constexpr std::size_t stack_size = 1 << 20;
+constexpr std::size_t page_size = 4096;
+constexpr std::uint8_t paint = 0xA5;
+/// Room left below the stack pointer for memset's own frame
+constexpr std::size_t call_headroom = 256;
+
+struct job
+{
+  void (*function)(void*);
+  void* context;
+  std::uint8_t* bottom;
+  std::size_t used;
+};
+
+[[gnu::always_inline]] inline std::uint8_t* stack_pointer()
+{
+  void* pointer = nullptr;
+#if defined(__x86_64__)
+  asm volatile("mov %%rsp, %0" : "=r"(pointer));
+#elif defined(__aarch64__) || defined(__arm__)
+  asm volatile("mov %0, sp" : "=r"(pointer));
+#else
+  pointer = __builtin_frame_address(0);
+#endif
+  return static_cast<std::uint8_t*>(pointer);
+}
+
+// Everything between painting and scanning must stay in this frame: any call
+// other than the measured one would leave its own marks below the stack
+// pointer. Hence the volatile loops instead of library calls.
+void* run(void* p_job)
+{
+  auto* job = static_cast<struct job*>(p_job);
+  auto* top = stack_pointer();
+
+  std::memset(job->bottom, paint, top - call_headroom - job->bottom);
+  for (volatile auto* byte = top - call_headroom; byte < top; byte++) {
+    *byte = paint;
+  }
+
+  job->function(job->context);
+
+  volatile auto* lowest = job->bottom;
+  while (lowest < top && *lowest == paint) {
+    lowest++;
+  }
+  job->used = static_cast<std::size_t>(top - lowest);
+  return nullptr;
+}
+}  // namespace
+
+std::size_t peak_stack_usage(void (*p_function)(void*), void* p_context)
+{
+  std::unique_ptr<std::uint8_t, decltype(&std::free)> stack(
+    static_cast<std::uint8_t*>(std::aligned_alloc(page_size, stack_size)),
+    &std::free);
+  if (!stack) {
+    return 0;
+  }
+
+  job job{ .function = p_function,
+           .context = p_context,
+           .bottom = stack.get(),
+           .used = 0 };
+  pthread_attr_t attributes;
+  pthread_attr_init(&attributes);
+  pthread_attr_setstack(&attributes, stack.get(), stack_size);
+  pthread_t thread;
+  auto created = pthread_create(&thread, &attributes, run, &job);
+  pthread_attr_destroy(&attributes);
+  if (created != 0) {
+    return 0;
+  }
+  pthread_join(thread, nullptr);
+  return job.used;
+}
+}  // namespace benchmark
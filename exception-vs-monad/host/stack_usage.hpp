@@ -0,0 +1,28 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+
+namespace benchmark {
+/// Deepest stack p_function(p_context) reaches, in bytes
+///
+/// The function runs on a new thread. Right before the call, the thread
+/// fills all of its stack below the stack pointer with a pattern. Right after
+/// it, the thread finds the lowest byte that no longer holds the pattern, the
+/// high water mark. A byte the function happens to write with the pattern
+/// value can make the result a few bytes low.
+std::size_t peak_stack_usage(void (*p_function)(void*), void* p_context);
+}  // namespace benchmark
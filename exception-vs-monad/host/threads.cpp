@@ -0,0 +1,238 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Driver that runs a variant's call chain on 1..N threads at once.
+//
+// Every thread makes the same calls down the same path. Per call latency is
+// timed inside each thread, throughput over all of them together. The variant
+// must be built with HOST_BENCHMARK_THREADS so that its fake registers and
+// side effects are thread_local, otherwise the threads fight over those
+// cache lines instead of over the unwinder.
+
+#include <algorithm>
+#include <barrier>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <benchmark.hpp>
+#include <harness.hpp>
+
+#if !defined(HOST_BENCHMARK_THREADS)
+#error "Build the variant with HOST_BENCHMARK_THREADS for thread_local state"
+#endif
+
+namespace harness {
+std::uint32_t depth_before_exception =
+  std::numeric_limits<std::uint32_t>::max();
+}  // namespace harness
+
+namespace {
+constexpr std::uint32_t never_fail = std::numeric_limits<std::uint32_t>::max();
+
+struct options
+{
+  benchmark::common_options common;
+  std::vector<unsigned> thread_counts;
+};
+
+thread_local volatile int sink = 0;
+
+/// Runs p_settings on p_threads threads with every call going down the path
+/// selected by p_threshold
+benchmark::statistics measure_threads(const char* p_name,
+                                      std::uint32_t p_threshold,
+                                      unsigned p_threads,
+                                      const benchmark::settings& p_settings)
+{
+  using clock = std::chrono::steady_clock;
+  struct span
+  {
+    clock::time_point start;
+    clock::time_point stop;
+  };
+
+  harness::depth_before_exception = p_threshold;
+  auto rounds = p_settings.warmup_trials + p_settings.trials;
+
+  // Threads start every round together. Throughput is measured from the
+  // first thread to start to the last one to stop, from their own clocks, so
+  // it does not depend on when a waiting main thread gets scheduled.
+  std::barrier sync(static_cast<std::ptrdiff_t>(p_threads));
+  std::vector<std::vector<span>> spans(p_threads, std::vector<span>(rounds));
+  std::vector<std::vector<double>> single_calls(p_threads);
+  {
+    std::vector<std::jthread> workers;
+    for (unsigned thread = 0; thread < p_threads; thread++) {
+      workers.emplace_back([&, thread]() {
+        for (auto& round : spans[thread]) {
+          sync.arrive_and_wait();
+          round.start = clock::now();
+          for (std::uint64_t i = 0; i < p_settings.calls_per_trial; i++) {
+            sink = harness::call_top();
+          }
+          round.stop = clock::now();
+        }
+        // The tail under the same contention, all threads at once again
+        sync.arrive_and_wait();
+        single_calls[thread] = benchmark::time_single_calls(
+          p_settings.tail_samples, []() { sink = harness::call_top(); });
+      });
+    }
+  }
+
+  std::vector<double> samples;
+  std::vector<double> throughputs;
+  auto calls = static_cast<double>(p_settings.calls_per_trial);
+  for (auto round = p_settings.warmup_trials; round < rounds; round++) {
+    auto first_start = spans[0][round].start;
+    auto last_stop = spans[0][round].stop;
+    for (const auto& thread_spans : spans) {
+      const auto& [start, stop] = thread_spans[round];
+      std::chrono::duration<double, std::nano> elapsed = stop - start;
+      // Every thread's trials are samples of the same per call latency
+      samples.push_back(elapsed.count() / calls);
+      first_start = std::min(first_start, start);
+      last_stop = std::max(last_stop, stop);
+    }
+    std::chrono::duration<double> wall = last_stop - first_start;
+    throughputs.push_back(calls * p_threads / wall.count());
+  }
+
+  std::vector<double> tail;
+  for (const auto& thread_calls : single_calls) {
+    tail.insert(tail.end(), thread_calls.begin(), thread_calls.end());
+  }
+
+  auto result = benchmark::summarize(p_name,
+                                     p_settings.calls_per_trial,
+                                     std::move(samples),
+                                     p_settings.outlier_cutoff,
+                                     std::move(tail));
+  auto throughput = benchmark::summarize(
+    "throughput", 1, std::move(throughputs), p_settings.outlier_cutoff);
+  result.parameters = {
+    { "threads", p_threads },
+    { "calls_per_second", throughput.median },
+    { "calls_per_second_min", throughput.min },
+  };
+  return result;
+}
+
+std::vector<unsigned> parse_counts(const char* p_text)
+{
+  std::vector<unsigned> counts;
+  char* end = nullptr;
+  for (const char* cursor = p_text; *cursor != '\0'; cursor = end) {
+    auto count = std::strtoul(cursor, &end, 10);
+    if (end == cursor || count == 0) {
+      return {};
+    }
+    counts.push_back(static_cast<unsigned>(count));
+    if (*end == ',') {
+      end++;
+    }
+  }
+  return counts;
+}
+
+/// Powers of two up to the number of hardware threads, plus that number
+std::vector<unsigned> default_counts()
+{
+  auto hardware = std::max(1U, std::thread::hardware_concurrency());
+  std::vector<unsigned> counts;
+  for (unsigned count = 1; count < hardware; count *= 2) {
+    counts.push_back(count);
+  }
+  counts.push_back(hardware);
+  return counts;
+}
+
+/// The driver's own options, for benchmark::parse_options()
+bool parse_option(const char* p_name, const char* p_value, void* p_options)
+{
+  auto& options = *static_cast<struct options*>(p_options);
+  if (std::strcmp(p_name, "--threads") == 0) {
+    options.thread_counts = parse_counts(p_value);
+    return !options.thread_counts.empty();
+  }
+  return false;
+}
+
+double parameter(const benchmark::statistics& p_result,
+                 std::string_view p_name)
+{
+  for (const auto& [name, value] : p_result.parameters) {
+    if (name == p_name) {
+      return value;
+    }
+  }
+  return 0.0;
+}
+
+/// Throughput over the single thread run of the same path, when there is one
+void add_speedup(std::vector<benchmark::statistics>& p_results)
+{
+  for (auto& result : p_results) {
+    for (const auto& base : p_results) {
+      if (base.name == result.name && parameter(base, "threads") == 1.0) {
+        result.parameters.emplace_back(
+          "speedup",
+          parameter(result, "calls_per_second") /
+            parameter(base, "calls_per_second"));
+      }
+    }
+  }
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  options options;
+  if (!benchmark::parse_options(
+        argc, argv, options.common, {}, parse_option, &options)) {
+    std::fprintf(stderr,
+                 "usage: %s [--happy-iterations N] [--error-iterations N]\n"
+                 "       [--trials N] [--warmup-trials N]\n"
+                 "       [--outlier-cutoff X] [--tail-samples N]\n"
+                 "       [--threads n,n,...] [--json FILE|-]\n"
+                 "Iterations are calls per thread per trial.\n",
+                 argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (options.thread_counts.empty()) {
+    options.thread_counts = default_counts();
+  }
+
+  std::vector<benchmark::statistics> results;
+  for (auto threads : options.thread_counts) {
+    results.push_back(
+      measure_threads("happy", never_fail, threads, options.common.happy));
+    results.push_back(measure_threads(
+      "error", harness::failing_threshold, threads, options.common.error));
+  }
+  add_speedup(results);
+
+  if (!benchmark::write_results(
+        options.common.json_path, HOST_BENCHMARK_VARIANT, results)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
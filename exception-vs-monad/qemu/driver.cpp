@@ -0,0 +1,229 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Driver for running a variant under qemu-system-arm on an mps2-an386
+// (Cortex-M4) machine.
+//
+// The variant is built with HOST_BENCHMARK, so it exposes its main() as
+// harness::call_top() and leaves out its own newlib stubs. This file owns
+// main() instead. It calls top_call() down the happy and the error path,
+// each bracketed by calls to qemu_marker_start() and qemu_marker_stop(). It
+// names each bracket over semihosting just before entering it, as a
+// "bracket <name>" line. The stack below the call is painted beforehand, and
+// a "stack <name> <bytes>" line reports how deep the call went.
+// tools/qemu_count.py counts the instructions QEMU executes between the
+// markers. The stubs below replace the variants' endless loops with
+// semihosting calls, so the program reports back and QEMU exits with the
+// program's status. Link with mps2_an386.ld.
+
+#include <cstdint>
+#include <exception>
+#include <limits>
+
+#include <harness.hpp>
+
+namespace harness {
+std::uint32_t depth_before_exception =
+  std::numeric_limits<std::uint32_t>::max();
+}  // namespace harness
+
+namespace {
+constexpr std::uint32_t never_fail = std::numeric_limits<std::uint32_t>::max();
+
+/// Each path is measured this many times. The first run includes one time
+/// costs, such as the first throw's lazy setup. The last one does not.
+constexpr int repeats = 2;
+
+// ARM semihosting operations and SYS_EXIT reasons
+constexpr std::uint32_t sys_write0 = 0x04;
+constexpr std::uint32_t sys_exit = 0x18;
+constexpr std::uint32_t application_exit = 0x20026;
+constexpr std::uint32_t run_time_error = 0x20023;
+
+std::uint32_t semihosting_call(std::uint32_t p_operation,
+                               const void* p_parameter)
+{
+  register std::uint32_t operation asm("r0") = p_operation;
+  register const void* parameter asm("r1") = p_parameter;
+  asm volatile("bkpt 0xab"
+               : "+r"(operation)
+               : "r"(parameter)
+               : "memory");
+  return operation;
+}
+
+void write(const char* p_text)
+{
+  semihosting_call(sys_write0, p_text);
+}
+
+[[noreturn]] void exit_qemu(int p_status)
+{
+  // Plain SYS_EXIT on 32-bit ARM only tells success from failure
+  auto reason = p_status == 0 ? application_exit : run_time_error;
+  semihosting_call(sys_exit, reinterpret_cast<const void*>(reason));
+  while (true) {
+    continue;
+  }
+}
+
+/// How far below main() the stack is painted before each call
+constexpr std::uint32_t stack_window = 64 * 1024;
+constexpr std::uint8_t paint = 0xA5;
+
+volatile int sink = 0;
+
+void write_number(std::uint32_t p_value)
+{
+  char digits[11] = {};
+  char* cursor = digits + sizeof(digits) - 1;
+  do {
+    *--cursor = static_cast<char>('0' + p_value % 10);
+    p_value /= 10;
+  } while (p_value != 0);
+  write(cursor);
+}
+
+[[gnu::always_inline]] inline std::uint8_t* stack_pointer()
+{
+  void* pointer = nullptr;
+  asm volatile("mov %0, sp" : "=r"(pointer));
+  return static_cast<std::uint8_t*>(pointer);
+}
+}  // namespace
+
+extern "C" std::uint8_t __stack;
+
+// Instructions executed from entering qemu_marker_start() until entering
+// qemu_marker_stop() are one measurement. They are never inlined so that they
+// keep their own addresses.
+extern "C"
+{
+  [[gnu::noinline, gnu::used]] void qemu_marker_start()
+  {
+    asm volatile("" ::: "memory");
+  }
+
+  [[gnu::noinline, gnu::used]] void qemu_marker_stop()
+  {
+    asm volatile("" ::: "memory");
+  }
+}
+
+namespace {
+void measure(const char* p_name, std::uint32_t p_threshold)
+{
+  write("bracket ");
+  write(p_name);
+  write("\n");
+  harness::depth_before_exception = p_threshold;
+
+  // Painting and scanning use volatile loops so that no call but the
+  // measured one leaves marks below the stack pointer
+  auto* top = stack_pointer();
+  volatile auto* bottom = &__stack - stack_window;
+  for (auto* byte = bottom; byte < top; byte++) {
+    *byte = paint;
+  }
+
+  qemu_marker_start();
+  sink = harness::call_top();
+  qemu_marker_stop();
+
+  auto* lowest = bottom;
+  while (lowest < top && *lowest == paint) {
+    lowest++;
+  }
+  write("stack ");
+  write(p_name);
+  write(" ");
+  write_number(static_cast<std::uint32_t>(top - lowest));
+  write("\n");
+}
+}  // namespace
+
+int main()
+{
+  // Same brackets around no work at all, subtracted from the others
+  write("bracket overhead\n");
+  qemu_marker_start();
+  qemu_marker_stop();
+
+  for (int repeat = 0; repeat < repeats; repeat++) {
+    measure("happy", never_fail);
+    measure("error", harness::failing_threshold);
+  }
+  return 0;
+}
+
+extern "C"
+{
+  // Enables the FPU, which the hard float ABI expects, then hands over to
+  // newlib's crt0 to set up the C runtime and call main()
+  [[noreturn]] void _start();
+
+  [[noreturn]] void qemu_reset()
+  {
+    constexpr std::uintptr_t cpacr_address = 0xE000ED88;
+    auto* cpacr = reinterpret_cast<volatile std::uint32_t*>(cpacr_address);
+    *cpacr = *cpacr | (0xFU << 20);
+    asm volatile("dsb\n\tisb" ::: "memory");
+    _start();
+  }
+
+  [[noreturn]] void qemu_fault()
+  {
+    write("fault\n");
+    exit_qemu(1);
+  }
+
+  [[gnu::section(".vectors"), gnu::used]] const void* const vectors[16] = {
+    &__stack,
+    reinterpret_cast<const void*>(qemu_reset),
+    // NMI, HardFault, MemManage, BusFault and UsageFault
+    reinterpret_cast<const void*>(qemu_fault),
+    reinterpret_cast<const void*>(qemu_fault),
+    reinterpret_cast<const void*>(qemu_fault),
+    reinterpret_cast<const void*>(qemu_fault),
+    reinterpret_cast<const void*>(qemu_fault),
+  };
+
+  void _exit(int rc)
+  {
+    exit_qemu(rc);
+  }
+
+  int kill(int, int)
+  {
+    return -1;
+  }
+
+  // Unlike the device stubs this leaves newlib's _impure_ptr alone. crt0
+  // returns from main() through exit(), which needs the real one.
+
+  int getpid()
+  {
+    return 1;
+  }
+}
+
+[[noreturn]] void terminate() noexcept
+{
+  write("terminate\n");
+  exit_qemu(1);
+}
+
+namespace __cxxabiv1 {
+std::terminate_handler __terminate_handler = terminate;
+}
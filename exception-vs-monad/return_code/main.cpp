@@ -13,15 +13,29 @@
 // limitations under the License.
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
 #include <tl/expected.hpp>
 
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#endif
+
 // Switches
 constexpr size_t error_size = 4;
+#if defined(HOST_BENCHMARK)
+// The host driver needs a reachable error path to time
+constexpr bool error_in_constructor = true;
+#else
 constexpr bool error_in_constructor = false;
+#endif
 constexpr bool error_in_class_function = false;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
 constexpr bool depth_before_exception = 50;
+#endif
 
 struct error_t
 {
@@ -42,7 +56,8 @@ public:
         return tl::unexpected(error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } });
       }
     }
-    enable_register = enable_register | (1 << p_channel);
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
     return non_trivial_destructor{ p_channel };
   }
 
@@ -55,16 +70,18 @@ public:
   {
     if constexpr (error_in_class_function) {
       if (m_channel >= depth_before_exception) {
-        tl::unexpected(error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } });
+        return tl::unexpected(error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } });
       }
     }
-    trigger_register = trigger_register | (1 << m_channel);
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
     return {};
   }
 
   ~non_trivial_destructor()
   {
-    enable_register = enable_register & ~(1 << m_channel);
+    enable_register =
+      enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
   }
 
 private:
@@ -86,7 +103,14 @@ tl::expected<void, error_t> top_call()
   return {};
 }
 
+#if defined(HOST_BENCHMARK)
+const std::uint32_t harness::failing_threshold = 50;
+const harness::result_layout harness::layout =
+  harness::describe<error_t, decltype(top_call())>();
+int harness::call_top()
+#else
 int main()
+#endif
 {
   auto result = top_call();
   if (!result) {
@@ -1,7 +1,20 @@
 # REGEX to find number of functions in disassembly
 # ^[0-9a-f]+ <fallible_function[0-9]+_group[0-9]+\(\)>:
+# and with --dispatch virtual
+# ^[0-9a-f]+ <fallible_function[0-9]+_group[0-9]+::driver_call\(\)>:
 
 import argparse
+import pathlib
+import re
+import string
+import sys
+import textwrap
+
+sys.path.insert(0, str(pathlib.Path(__file__).resolve().parents[1]))
+import split_sources  # noqa: E402
+
+# Objects with destructors in each frame that passes the error on
+MAX_OBJECTS = 16
 
 _FILE_HEADER = """
 // Copyright 2023 Google LLC
@@ -19,68 +32,97 @@ _FILE_HEADER = """
 // limitations under the License.
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <utility>
 
 #include <tl/expected.hpp>
 
-constexpr size_t error_size = 128;
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#else
+#define HARNESS_STATE
+#endif
+
+constexpr size_t error_size = @ERROR_SIZE@;
 constexpr bool error_in_constructor = true;
 constexpr bool error_in_class_function = true;
-constexpr uint8_t depth_before_exception = 50;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
+constexpr uint32_t depth_before_exception = 1000;
+#endif
 
 struct error_t
 {
   std::array<std::uint8_t, error_size> data;
 };
 
-volatile std::uint64_t enable_register;
-volatile std::uint64_t trigger_register;
+HARNESS_STATE volatile std::uint64_t enable_register;
+HARNESS_STATE volatile std::uint64_t trigger_register;
 
 class non_trivial_destructor
 {
 public:
   static tl::expected<non_trivial_destructor, error_t> initialize(
-    uint8_t p_channel)
+    uint32_t p_channel)
   {
     if constexpr (error_in_constructor) {
       if (p_channel >= depth_before_exception) {
         return tl::unexpected(error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } });
       }
     }
-    enable_register = enable_register | (1 << p_channel);
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
     return non_trivial_destructor{ p_channel };
   }
 
   non_trivial_destructor(non_trivial_destructor&) = delete;
   non_trivial_destructor& operator=(non_trivial_destructor&) = delete;
-  non_trivial_destructor(non_trivial_destructor&&) noexcept = default;
-  non_trivial_destructor& operator=(non_trivial_destructor&&) noexcept =
-    default;
+
+  // Taking the object out of a result moves it, and the moved-from one must
+  // not clear the channel the new one still holds when it is destroyed
+  non_trivial_destructor(non_trivial_destructor&& p_other) noexcept
+    : m_channel(std::exchange(p_other.m_channel, moved_from))
+  {
+  }
+
+  non_trivial_destructor& operator=(non_trivial_destructor&& p_other) noexcept
+  {
+    std::swap(m_channel, p_other.m_channel);
+    return *this;
+  }
 
   tl::expected<void, error_t> trigger()
   {
     if constexpr (error_in_class_function) {
       if (m_channel >= depth_before_exception) {
-        tl::unexpected(error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } });
+        return tl::unexpected(error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } });
       }
     }
-    trigger_register = trigger_register | (1 << (m_channel % 64));
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
 
     return {};
   }
 
   ~non_trivial_destructor()
   {
-    enable_register = enable_register & ~(1 << (m_channel % 64));
+    if (m_channel != moved_from) {
+      enable_register =
+        enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
+    }
   }
 
 private:
-  non_trivial_destructor(uint8_t p_channel)
+  static constexpr uint32_t moved_from = UINT32_MAX;
+
+  non_trivial_destructor(uint32_t p_channel)
     : m_channel(p_channel)
   {
   }
 
-  uint8_t m_channel = 0;
+  uint32_t m_channel = 0;
 };
 
 tl::expected<int, error_t> return_error();
@@ -93,7 +135,11 @@ tl::expected<int, error_t> top_call()
   return result.value();
 }
 
+#if defined(HOST_BENCHMARK)
+int harness::call_top()
+#else
 int main()
+#endif
 {
   auto result = top_call();
   if (!result) {
@@ -106,6 +152,44 @@ int main()
 // Add generated code below
 // =============================================================================
 """
+_LIBRARY_INCLUDES = {
+    "tl": "#include <tl/expected.hpp>",
+    "std": "#include <expected>",
+    "leaf": """// Same configuration as the firmware projects' libhal.tweaks.hpp
+#define BOOST_LEAF_EMBEDDED
+#define BOOST_LEAF_NO_THREADS
+#include <boost/leaf.hpp>""",
+    "compact": "#include <compact_result.hpp>",
+}
+
+_MAIN_BODY = """{
+  auto result = top_call();
+  if (!result) {
+    return static_cast<int>(result.error().data[0]);
+  }
+  return result.value();
+}"""
+
+_LEAF_MAIN_BODY = """{
+  return boost::leaf::try_handle_all(
+    []() -> boost::leaf::result<int> { return top_call(); },
+    [](const error_t& p_error) { return static_cast<int>(p_error.data[0]); },
+    []() { return 15; });
+}"""
+
+# Where the part after the shared declarations starts, to split the header
+# when writing several translation units
+_PROGRAM_START = "tl::expected<int, error_t> return_error();\n"
+
+_HOST_HOOKS_FORMAT = """
+#if defined(HOST_BENCHMARK)
+// Fail in the last frame of group 0 so the error crosses every frame
+const std::uint32_t harness::failing_threshold = {max_depth};
+const harness::result_layout harness::layout =
+  harness::describe<error_t, decltype(top_call())>();
+#endif
+"""
+
 _RETURN_ERROR_FORMAT = """
 {forward_declarations}
 tl::expected<int, error_t> return_error()
@@ -114,46 +198,370 @@ tl::expected<int, error_t> return_error()
   return {sum};
 }}
 """
-_RETURN_FORWARD_ENTRY = """tl::expected<int, error_t>
-fallible_function0_group{group}();
-volatile int side_effect{group} = 0;
+_RETURN_FORWARD_ENTRY = """tl::expected<int, error_t> fallible_function0_group{group}();
+HARNESS_STATE volatile int side_effect{group} = 0;
 """
 _RETURN_ERROR_FORMAT_ENTRY = """
-  if(auto result = fallible_function0_group{group}(); !result) {{
+  if (auto result = fallible_function0_group{group}(); !result) {{
     return tl::unexpected(result.error());
   }}"""
 _RETURN_SUM = """side_effect{group}"""
 
 _DEPTH_FUNCTION_FORMAT = """
-  tl::expected<int, error_t>
-  fallible_function{next_depth}_group{group}();
+tl::expected<int, error_t> fallible_function{next_depth}_group{group}();
 
-  tl::expected<int, error_t>
-  fallible_function{depth}_group{group}()
-  {{
-    auto result_a = non_trivial_destructor::initialize({group});
+tl::expected<int, error_t> fallible_function{depth}_group{group}()
+{{
+{objects}  if (auto result = fallible_function{next_depth}_group{group}(); result) {{
+    side_effect{group} = side_effect{group} + result.value();
+  }} else {{
+    return tl::unexpected(result.error());
+  }}
 
-    if (result_a) {{
-      auto result_internal = result_a.value().trigger();
-      if (!result_internal) {{
-        return tl::unexpected(result_internal.error());
-      }}
-    }} else {{
-      return tl::unexpected(result_a.error());
+  return side_effect{group};
+}}
+"""
+
+# One object of a frame that passes the error on, named result_a, result_b
+# and so on. The last frame, which fails, keeps its own object.
+_OBJECT_FORMAT = """  auto result_{name} = {type}::initialize({depth});
+
+  if (result_{name}) {{
+    auto result_internal = result_{name}.value().trigger();
+    if (!result_internal) {{
+      return tl::unexpected(result_internal.error());
     }}
+  }} else {{
+    return tl::unexpected(result_{name}.error());
+  }}
 
-    auto result_b = non_trivial_destructor::initialize({group});
+"""
 
-    if (result_b) {{
-      auto result_internal = result_b.value().trigger();
-      if (!result_internal) {{
-        return tl::unexpected(result_internal.error());
-      }}
-    }} else {{
-      return tl::unexpected(result_b.error());
+_LAST_DEPTH_FUNCTION_FORMAT = """
+tl::expected<int, error_t> fallible_function{depth}_group{group}()
+{{
+  if (auto result = non_trivial_destructor::initialize({depth}); result) {{
+    auto result_internal = result.value().trigger();
+    if (!result_internal) {{
+      return tl::unexpected(result_internal.error());
     }}
+  }} else {{
+    return tl::unexpected(result.error());
+  }}
+
+  return side_effect{group} + 1;
+}}
+"""
+
+# Works like libhal's HAL_CHECK, as used throughout the firmware projects.
+# hal_check_value() lets the same macro check results without a value, which
+# not every library gives a value() member.
+_CHECK_MACRO = """template<typename Result>
+decltype(auto) hal_check_value(Result& p_result)
+{
+  if constexpr (requires { std::move(p_result.value()); }) {
+    return std::move(p_result.value());
+  }
+}
+
+// Evaluates to the value of a successful result. Returns the error of a
+// failed one from the calling function.
+#define HAL_CHECK(expression)                                                  \\
+  ({                                                                           \\
+    auto&& hal_check_result = (expression);                                    \\
+    if (!bool(hal_check_result)) {                                             \\
+      return tl::unexpected(hal_check_result.error());                         \\
+    }                                                                          \\
+    hal_check_value(hal_check_result);                                         \\
+  })
+
+"""
+
+_CHECK_RETURN_ERROR_ENTRY = """
+  HAL_CHECK(fallible_function0_group{group}());"""
+
+_CHECK_DEPTH_FUNCTION_FORMAT = """
+tl::expected<int, error_t> fallible_function{next_depth}_group{group}();
+
+tl::expected<int, error_t> fallible_function{depth}_group{group}()
+{{
+{objects}  side_effect{group} = side_effect{group} + HAL_CHECK(fallible_function{next_depth}_group{group}());
+
+  return side_effect{group};
+}}
+"""
+
+_CHECK_OBJECT_FORMAT = """\
+  auto object_{name} = HAL_CHECK({type}::initialize({depth}));
+  HAL_CHECK(object_{name}.trigger());
+
+"""
+
+_CHECK_LAST_DEPTH_FUNCTION_FORMAT = """
+tl::expected<int, error_t> fallible_function{depth}_group{group}()
+{{
+  auto object = HAL_CHECK(non_trivial_destructor::initialize({depth}));
+  HAL_CHECK(object.trigger());
+
+  return side_effect{group} + 1;
+}}
+"""
+
+_MONADIC_MAIN_BODY = """{
+  return *top_call().or_else(
+    [](const error_t& p_error) -> tl::expected<int, error_t> {
+      return static_cast<int>(p_error.data[0]);
+    });
+}"""
+
+_MONADIC_RETURN_ERROR_FORMAT = """
+{forward_declarations}
+tl::expected<int, error_t> return_error()
+{{
+  return fallible_function0_group0(){usages}
+    .map([](int) {{ return {sum}; }});
+}}
+"""
+_MONADIC_RETURN_ERROR_ENTRY = """
+    .and_then([](int) {{ return fallible_function0_group{group}(); }})"""
+
+# The objects stay in result_a, result_b and so on, so they are destroyed
+# when the function returns, like in the explicit style. {chain} triggers the
+# last one and calls the next frame.
+_MONADIC_DEPTH_FUNCTION_FORMAT = """
+tl::expected<int, error_t> fallible_function{next_depth}_group{group}();
+
+tl::expected<int, error_t> fallible_function{depth}_group{group}()
+{{
+{objects}  return {chain}
+    .map([](int p_value) {{
+      side_effect{group} = side_effect{group} + p_value;
+      return side_effect{group};
+    }});
+}}
+"""
+
+_MONADIC_FIRST_OBJECT_FORMAT = """\
+  auto result_{name} = {type}::initialize({depth});
+"""
+
+# Each object is created once the one before it has been triggered
+_MONADIC_OBJECT_FORMAT = """\
+  auto result_{name} =
+    result_{previous}
+      .and_then([]({type}& p_{previous}) {{ return p_{previous}.trigger(); }})
+      .and_then(
+        []() {{ return {type}::initialize({depth}); }});
+"""
+
+_MONADIC_CHAIN_FORMAT = """\
+result_{name}
+    .and_then([]({type}& p_{name}) {{ return p_{name}.trigger(); }})
+    .and_then(
+      []() {{ return fallible_function{next_depth}_group{group}(); }})"""
+
+_MONADIC_LAST_DEPTH_FUNCTION_FORMAT = """
+tl::expected<int, error_t> fallible_function{depth}_group{group}()
+{{
+  auto result = non_trivial_destructor::initialize({depth});
+  return result
+    .and_then(
+      [](non_trivial_destructor& p_object) {{ return p_object.trigger(); }})
+    .map([]() {{ return side_effect{group} + 1; }});
+}}
+"""
+
+# Every fallible function is a coro::task coroutine. The objects' operations
+# still return tl::expected, and co_await on a failed one short-circuits
+# the whole chain back to main().
+_COROUTINE_INCLUDE = "#include <coroutine_result.hpp>\n"
+
+_TOP_CALL = """tl::expected<int, error_t> return_error();
+tl::expected<int, error_t> top_call()
+{
+  auto result = return_error();
+  if (!result) {
+    return tl::unexpected(result.error());
+  }
+  return result.value();
+}
+"""
+
+_COROUTINE_PROGRAM_START = "coro::task<int, error_t> return_error();\n"
+
+_COROUTINE_TOP_CALL = _COROUTINE_PROGRAM_START + """\
+coro::task<int, error_t> top_call()
+{
+  co_return co_await return_error();
+}
+"""
+
+_COROUTINE_MAIN_BODY = """{
+  coro::failure<error_t> failure;
+  auto task = top_call();
+  if (!task.run(failure)) {
+    return static_cast<int>(failure.error.data[0]);
+  }
+  return task.value();
+}"""
+
+_COROUTINE_RETURN_ERROR_FORMAT = """
+{forward_declarations}
+coro::task<int, error_t> return_error()
+{{
+{usages}
+  co_return {sum};
+}}
+"""
+_COROUTINE_RETURN_FORWARD_ENTRY = """coro::task<int, error_t> fallible_function0_group{group}();
+HARNESS_STATE volatile int side_effect{group} = 0;
+"""
+_COROUTINE_RETURN_ERROR_ENTRY = """
+  co_await fallible_function0_group{group}();"""
+
+_COROUTINE_DEPTH_FUNCTION_FORMAT = """
+coro::task<int, error_t> fallible_function{next_depth}_group{group}();
+
+coro::task<int, error_t> fallible_function{depth}_group{group}()
+{{
+{objects}  side_effect{group} =
+    side_effect{group} + co_await fallible_function{next_depth}_group{group}();
+
+  co_return side_effect{group};
+}}
+"""
+
+_COROUTINE_OBJECT_FORMAT = """\
+  auto object_{name} = co_await {type}::initialize({depth});
+  co_await object_{name}.trigger();
+
+"""
 
-    if(auto result = fallible_function{next_depth}_group{group}(); result) {{
+_COROUTINE_LAST_DEPTH_FUNCTION_FORMAT = """
+coro::task<int, error_t> fallible_function{depth}_group{group}()
+{{
+  auto object = co_await non_trivial_destructor::initialize({depth});
+  co_await object.trigger();
+
+  co_return side_effect{group} + 1;
+}}
+"""
+
+# How the generated functions propagate errors: the forward declarations of
+# each group's first function, return_error() format, its per group entry,
+# the depth function formats and main()'s body
+_STYLES = {
+    "explicit": (_RETURN_FORWARD_ENTRY, _RETURN_ERROR_FORMAT,
+                 _RETURN_ERROR_FORMAT_ENTRY, _DEPTH_FUNCTION_FORMAT,
+                 _LAST_DEPTH_FUNCTION_FORMAT, _MAIN_BODY),
+    "monadic": (_RETURN_FORWARD_ENTRY, _MONADIC_RETURN_ERROR_FORMAT,
+                _MONADIC_RETURN_ERROR_ENTRY, _MONADIC_DEPTH_FUNCTION_FORMAT,
+                _MONADIC_LAST_DEPTH_FUNCTION_FORMAT, _MONADIC_MAIN_BODY),
+    "check": (_RETURN_FORWARD_ENTRY, _RETURN_ERROR_FORMAT,
+              _CHECK_RETURN_ERROR_ENTRY, _CHECK_DEPTH_FUNCTION_FORMAT,
+              _CHECK_LAST_DEPTH_FUNCTION_FORMAT, _MAIN_BODY),
+    "coroutine": (_COROUTINE_RETURN_FORWARD_ENTRY,
+                  _COROUTINE_RETURN_ERROR_FORMAT,
+                  _COROUTINE_RETURN_ERROR_ENTRY,
+                  _COROUTINE_DEPTH_FUNCTION_FORMAT,
+                  _COROUTINE_LAST_DEPTH_FUNCTION_FORMAT,
+                  _COROUTINE_MAIN_BODY),
+}
+
+# The first object of a frame and every one after it, for each style
+_OBJECT_FORMATS = {
+    "explicit": (_OBJECT_FORMAT, _OBJECT_FORMAT),
+    "monadic": (_MONADIC_FIRST_OBJECT_FORMAT, _MONADIC_OBJECT_FORMAT),
+    "check": (_CHECK_OBJECT_FORMAT, _CHECK_OBJECT_FORMAT),
+    "coroutine": (_COROUTINE_OBJECT_FORMAT, _COROUTINE_OBJECT_FORMAT),
+}
+
+# Does the same work as non_trivial_destructor but leaves nothing to undo, so
+# frames that only hold these have nothing to clean up on an early return
+_TRIVIAL_CLASS = """class trivial_destructor
+{
+public:
+  static tl::expected<trivial_destructor, error_t> initialize(
+    uint32_t p_channel)
+  {
+    if constexpr (error_in_constructor) {
+      if (p_channel >= depth_before_exception) {
+        return tl::unexpected(error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } });
+      }
+    }
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
+    return trivial_destructor{ p_channel };
+  }
+
+  tl::expected<void, error_t> trigger()
+  {
+    if constexpr (error_in_class_function) {
+      if (m_channel >= depth_before_exception) {
+        return tl::unexpected(error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } });
+      }
+    }
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
+
+    return {};
+  }
+
+private:
+  trivial_destructor(uint32_t p_channel)
+    : m_channel(p_channel)
+  {
+  }
+
+  uint32_t m_channel = 0;
+};
+
+"""
+
+# With --dispatch virtual every frame is a driver behind an interface, like
+# the libhal drivers, and calls the next frame through that interface
+_DRIVER_INTERFACE = """\
+// Shaped like a libhal interface: the public function forwards to a private
+// virtual driver_*() function that every driver implements
+class fallible_driver
+{
+public:
+  tl::expected<int, error_t> call()
+  {
+    return driver_call();
+  }
+
+  virtual ~fallible_driver() = default;
+
+private:
+  virtual tl::expected<int, error_t> driver_call() = 0;
+};
+
+"""
+
+_VIRTUAL_RETURN_FORWARD_ENTRY = """extern fallible_driver& driver0_group{group};
+HARNESS_STATE volatile int side_effect{group} = 0;
+"""
+_VIRTUAL_RETURN_ERROR_FORMAT_ENTRY = """
+  if (auto result = driver0_group{group}.call(); !result) {{
+    return tl::unexpected(result.error());
+  }}"""
+
+_VIRTUAL_DEPTH_FUNCTION_FORMAT = """
+extern fallible_driver& driver{next_depth}_group{group};
+
+class fallible_function{depth}_group{group} final : public fallible_driver
+{{
+public:
+  fallible_function{depth}_group{group}(fallible_driver& p_next)
+    : m_next(&p_next)
+  {{
+  }}
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {{
+{objects}    if (auto result = m_next->call(); result) {{
       side_effect{group} = side_effect{group} + result.value();
     }} else {{
       return tl::unexpected(result.error());
@@ -161,11 +569,20 @@ _DEPTH_FUNCTION_FORMAT = """
 
     return side_effect{group};
   }}
-  """
 
-_LAST_DEPTH_FUNCTION_FORMAT = """
-  tl::expected<int, error_t>
-  fallible_function{depth}_group{group}()
+  fallible_driver* m_next;
+}};
+
+static fallible_function{depth}_group{group} instance{depth}_group{group}(
+  driver{next_depth}_group{group});
+fallible_driver& driver{depth}_group{group} = instance{depth}_group{group};
+"""
+
+_VIRTUAL_LAST_DEPTH_FUNCTION_FORMAT = """
+class fallible_function{depth}_group{group} final : public fallible_driver
+{{
+private:
+  tl::expected<int, error_t> driver_call() override
   {{
     if (auto result = non_trivial_destructor::initialize({depth}); result) {{
       auto result_internal = result.value().trigger();
@@ -178,45 +595,204 @@ _LAST_DEPTH_FUNCTION_FORMAT = """
 
     return side_effect{group} + 1;
   }}
-  """
+}};
+
+static fallible_function{depth}_group{group} instance{depth}_group{group};
+fallible_driver& driver{depth}_group{group} = instance{depth}_group{group};
+"""
 
+# How each frame calls the next: the return_error() forward declarations, the
+# calls in return_error() and the frame formats. Virtual dispatch is written
+# in the explicit style.
+_DISPATCHES = {
+    "direct": None,
+    "virtual": (_VIRTUAL_RETURN_FORWARD_ENTRY,
+                _VIRTUAL_RETURN_ERROR_FORMAT_ENTRY,
+                _VIRTUAL_DEPTH_FUNCTION_FORMAT,
+                _VIRTUAL_LAST_DEPTH_FUNCTION_FORMAT),
+}
 
-def do_the_thing(max_groups: int, max_depth: int):
+# Libraries with and_then, map and or_else
+_MONADIC_LIBRARIES = ["tl", "std"]
+# Libraries whose error() is the error_t that coro::failure holds
+_COROUTINE_LIBRARIES = ["tl", "std", "compact"]
+
+
+def translate(code: str, library: str) -> str:
+    """Rewrite code written against tl::expected for another result library"""
+    code = code.replace(_LIBRARY_INCLUDES["tl"], _LIBRARY_INCLUDES[library])
+    if library == "std":
+        code = code.replace("tl::", "std::")
+        # std::expected calls map transform
+        code = code.replace(".map(", ".transform(")
+    elif library == "leaf":
+        code = code.replace(_MAIN_BODY, _LEAF_MAIN_BODY)
+        code = re.sub(r"tl::expected<(.+?), error_t>",
+                      r"boost::leaf::result<\1>", code)
+        code = re.sub(r"tl::unexpected\((\w+)\.error\(\)\)",
+                      r"\1.error()", code)
+        code = code.replace("tl::unexpected(error_t",
+                            "boost::leaf::new_error(error_t")
+    elif library == "compact":
+        code = re.sub(r"tl::expected<(.+?), error_t>",
+                      r"compact::result<\1, error_t>", code)
+        code = re.sub(r"tl::unexpected\((\w+)\.error\(\)\)",
+                      r"\1.forward_error()", code)
+        code = code.replace("tl::unexpected(error_t", "compact::raise(error_t")
+    return code
+
+
+def object_count(text: str) -> int:
+    count = int(text)
+    if not 0 <= count <= MAX_OBJECTS:
+        raise argparse.ArgumentTypeError(
+            f"{count} is not between 0 and {MAX_OBJECTS}")
+    return count
+
+
+def frame_objects(style: str, count: int, type: str, depth: int) -> str:
+    """The objects of one frame that passes the error on"""
+    first_format, next_format = _OBJECT_FORMATS[style]
+    names = string.ascii_lowercase[:count]
+    code = [first_format.format(name=name, type=type, depth=depth)
+            for name in names[:1]]
+    code += [next_format.format(name=name, previous=previous, type=type,
+                                depth=depth)
+             for previous, name in zip(names, names[1:])]
+    if style == "monadic" and code:
+        code.append("\n")
+    return "".join(code)
+
+
+def frame_chain(style: str, count: int, type: str, next_depth: int,
+                group: int) -> str:
+    """How a monadic frame triggers its last object and calls the next"""
+    call = f"fallible_function{next_depth}_group{group}()"
+    if style != "monadic" or count == 0:
+        return call
+    return _MONADIC_CHAIN_FORMAT.format(name=string.ascii_lowercase[count - 1],
+                                        type=type, next_depth=next_depth,
+                                        group=group)
+
+
+def error_size(text: str) -> int:
+    """error_t is initialized with 4 bytes, so it cannot be any smaller"""
+    size = int(text)
+    if size < 4:
+        raise argparse.ArgumentTypeError(f"{size} is smaller than 4 bytes")
+    return size
+
+
+def do_the_thing(max_groups: int, max_depth: int, library: str = "tl",
+                 error_size: int = 128, translation_units: int = 1,
+                 output_directory: str = None, style: str = "explicit",
+                 dispatch: str = "direct", objects: int = 2,
+                 trivial_objects: bool = False):
+    (forward_entry, return_error_format, return_error_entry,
+     depth_function_format, last_depth_function_format,
+     main_body) = _STYLES[style]
+    if _DISPATCHES[dispatch] is not None:
+        (forward_entry, return_error_entry, depth_function_format,
+         last_depth_function_format) = _DISPATCHES[dispatch]
     return_error_function_calls = []
     forwards = []
     sums = []
     for group in range(max_groups):
-        forwards.append(_RETURN_FORWARD_ENTRY.format(group=group))
-        return_error_function_calls.append(
-            _RETURN_ERROR_FORMAT_ENTRY.format(group=group))
+        forwards.append(forward_entry.format(group=group))
+        # The monadic chain starts with group 0's call
+        if style != "monadic" or group > 0:
+            return_error_function_calls.append(
+                return_error_entry.format(group=group))
         sums.append(_RETURN_SUM.format(group=group))
 
     sums_string = "+".join(sums)
     forward_string = "\n".join(forwards)
-    call_string = "\n".join(return_error_function_calls)
-    full_return_error_str = _RETURN_ERROR_FORMAT.format(
-        forward_declarations=forward_string,
-        usages=call_string,
-        sum=sums_string)
-
-    print(_FILE_HEADER)
-    print(full_return_error_str)
+    call_string = ("" if style == "monadic" else "\n").join(
+        return_error_function_calls)
 
-    list_of_functions_and_groups = []
+    # Frame d of every group goes to unit d % translation_units, so with
+    # more than one unit every call down a chain crosses into another unit
+    functions_per_unit = [[] for _ in range(translation_units)]
 
+    object_type = ("trivial_destructor" if trivial_objects
+                   else "non_trivial_destructor")
     for group in range(max_groups):
         for depth in range(max_depth):
-            list_of_functions_and_groups.append(_DEPTH_FUNCTION_FORMAT.format(
-                next_group=group + 1,
-                next_depth=depth + 1,
-                group=group,
-                depth=depth,
-            ))
-        list_of_functions_and_groups.append(_LAST_DEPTH_FUNCTION_FORMAT.format(
-            depth=max_depth,
-            group=group))
-
-    print("".join(list_of_functions_and_groups))
+            object_code = frame_objects(style, objects, object_type, depth)
+            if dispatch == "virtual":
+                object_code = textwrap.indent(object_code, "  ")
+            functions_per_unit[depth % translation_units].append(
+                depth_function_format.format(
+                    next_group=group + 1,
+                    next_depth=depth + 1,
+                    group=group,
+                    depth=depth,
+                    objects=object_code,
+                    chain=frame_chain(style, objects, object_type,
+                                      depth + 1, group),
+                ))
+        functions_per_unit[max_depth % translation_units].append(
+            last_depth_function_format.format(
+                depth=max_depth,
+                group=group))
+
+    header = _FILE_HEADER.replace("@ERROR_SIZE@", str(error_size))
+    header = header.replace(_MAIN_BODY, main_body)
+    if trivial_objects:
+        header = header.replace(_PROGRAM_START,
+                                _TRIVIAL_CLASS + _PROGRAM_START)
+    if style == "check":
+        header = header.replace(_PROGRAM_START, _CHECK_MACRO + _PROGRAM_START)
+    if dispatch == "virtual":
+        header = header.replace(_PROGRAM_START,
+                                _DRIVER_INTERFACE + _PROGRAM_START)
+    program_start = _PROGRAM_START
+    if style == "coroutine":
+        header = header.replace(_LIBRARY_INCLUDES["tl"],
+                                _COROUTINE_INCLUDE + _LIBRARY_INCLUDES["tl"])
+        header = header.replace(_TOP_CALL, _COROUTINE_TOP_CALL)
+        program_start = _COROUTINE_PROGRAM_START
+    hooks = _HOST_HOOKS_FORMAT.format(max_depth=max_depth)
+    if translation_units == 1:
+        program = "\n".join([
+            header,
+            hooks,
+            return_error_format.format(forward_declarations=forward_string,
+                                       usages=call_string,
+                                       sum=sums_string),
+            "".join(functions_per_unit[0]),
+        ])
+        if output_directory is None:
+            print(translate(program, library))
+        else:
+            split_sources.write_units(
+                output_directory, [("main.cpp", translate(program, library))])
+        return
+
+    license, declarations, program = split_sources.split_header(
+        header, program_start)
+    include = license + '\n#include "common.hpp"\n'
+    units = [
+        ("common.hpp", "\n".join([
+            license + "\n#pragma once",
+            split_sources.shareable(declarations),
+            split_sources.shareable(forward_string),
+        ])),
+        ("main.cpp", "\n".join([
+            include + program,
+            hooks,
+            return_error_format.format(forward_declarations="",
+                                       usages=call_string,
+                                       sum=sums_string),
+            "".join(functions_per_unit[0]),
+        ])),
+    ]
+    units += [(f"unit{unit}.cpp", include + "".join(functions))
+              for unit, functions in enumerate(functions_per_unit)
+              if unit > 0]
+    split_sources.write_units(
+        output_directory,
+        [(name, translate(text, library)) for name, text in units])
 
 
 if __name__ == "__main__":
@@ -225,5 +801,45 @@ if __name__ == "__main__":
                         help="Number of groups", default=10, type=int)
     parser.add_argument("-d", "--max_depth",
                         help="Max depth of functions", default=50, type=int)
+    parser.add_argument("-e", "--error_size", type=error_size, default=128,
+                        help="Bytes in error_t, at least 4")
+    parser.add_argument("-l", "--library",
+                        help="Result type to propagate errors with",
+                        default="tl", choices=list(_LIBRARY_INCLUDES))
+    parser.add_argument("-s", "--style", default="explicit",
+                        choices=list(_STYLES),
+                        help="Propagate errors with if statements, with "
+                        "and_then/map/or_else, with HAL_CHECK or with "
+                        "co_await in coroutines")
+    parser.add_argument("--dispatch", default="direct",
+                        choices=list(_DISPATCHES),
+                        help="Call the next frame directly or through a "
+                        "virtual driver interface")
+    parser.add_argument("--objects", type=object_count, default=2,
+                        help="Objects in each frame that passes the error "
+                        f"on, 0 to {MAX_OBJECTS}")
+    parser.add_argument("--trivial_objects", action="store_true",
+                        help="Give those objects no destructor, as a "
+                        "control")
+    parser.add_argument("-u", "--translation_units", default=1, type=int,
+                        help="Source files to spread the frames over")
+    parser.add_argument("-o", "--output_directory",
+                        help="Write main.cpp (and with more than one unit, "
+                        "common.hpp and unitN.cpp) here instead of stdout")
     args = parser.parse_args()
-    do_the_thing(max_depth=args.max_depth, max_groups=args.max_groups)
+    if args.translation_units > 1 and args.output_directory is None:
+        parser.error("--translation_units needs --output_directory")
+    if args.style == "monadic" and args.library not in _MONADIC_LIBRARIES:
+        parser.error(f"{args.library} has no and_then, map and or_else")
+    if (args.style == "coroutine"
+            and args.library not in _COROUTINE_LIBRARIES):
+        parser.error(f"{args.library}'s error() is not an error_t")
+    if args.dispatch == "virtual" and args.style != "explicit":
+        parser.error("--dispatch virtual is only written in the explicit "
+                     "style")
+    do_the_thing(max_depth=args.max_depth, max_groups=args.max_groups,
+                 library=args.library, error_size=args.error_size,
+                 translation_units=args.translation_units,
+                 output_directory=args.output_directory, style=args.style,
+                 dispatch=args.dispatch, objects=args.objects,
+                 trivial_objects=args.trivial_objects)
@@ -14,68 +14,97 @@
 // limitations under the License.
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <utility>
 
 #include <tl/expected.hpp>
 
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#else
+#define HARNESS_STATE
+#endif
+
 constexpr size_t error_size = 128;
 constexpr bool error_in_constructor = true;
 constexpr bool error_in_class_function = true;
-constexpr uint8_t depth_before_exception = 50;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
+constexpr uint32_t depth_before_exception = 1000;
+#endif
 
 struct error_t
 {
   std::array<std::uint8_t, error_size> data;
 };
 
-volatile std::uint64_t enable_register;
-volatile std::uint64_t trigger_register;
+HARNESS_STATE volatile std::uint64_t enable_register;
+HARNESS_STATE volatile std::uint64_t trigger_register;
 
 class non_trivial_destructor
 {
 public:
   static tl::expected<non_trivial_destructor, error_t> initialize(
-    uint8_t p_channel)
+    uint32_t p_channel)
   {
     if constexpr (error_in_constructor) {
       if (p_channel >= depth_before_exception) {
         return tl::unexpected(error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } });
       }
     }
-    enable_register = enable_register | (1 << p_channel);
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
     return non_trivial_destructor{ p_channel };
   }
 
   non_trivial_destructor(non_trivial_destructor&) = delete;
   non_trivial_destructor& operator=(non_trivial_destructor&) = delete;
-  non_trivial_destructor(non_trivial_destructor&&) noexcept = default;
-  non_trivial_destructor& operator=(non_trivial_destructor&&) noexcept =
-    default;
+
+  // Taking the object out of a result moves it, and the moved-from one must
+  // not clear the channel the new one still holds when it is destroyed
+  non_trivial_destructor(non_trivial_destructor&& p_other) noexcept
+    : m_channel(std::exchange(p_other.m_channel, moved_from))
+  {
+  }
+
+  non_trivial_destructor& operator=(non_trivial_destructor&& p_other) noexcept
+  {
+    std::swap(m_channel, p_other.m_channel);
+    return *this;
+  }
 
   tl::expected<void, error_t> trigger()
   {
     if constexpr (error_in_class_function) {
       if (m_channel >= depth_before_exception) {
-        tl::unexpected(error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } });
+        return tl::unexpected(error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } });
       }
     }
-    trigger_register = trigger_register | (1 << (m_channel % 64));
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
 
     return {};
   }
 
   ~non_trivial_destructor()
   {
-    enable_register = enable_register & ~(1 << (m_channel % 64));
+    if (m_channel != moved_from) {
+      enable_register =
+        enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
+    }
   }
 
 private:
-  non_trivial_destructor(uint8_t p_channel)
+  static constexpr uint32_t moved_from = UINT32_MAX;
+
+  non_trivial_destructor(uint32_t p_channel)
     : m_channel(p_channel)
   {
   }
 
-  uint8_t m_channel = 0;
+  uint32_t m_channel = 0;
 };
 
 tl::expected<int, error_t> return_error();
@@ -88,7 +117,11 @@ tl::expected<int, error_t> top_call()
   return result.value();
 }
 
+#if defined(HOST_BENCHMARK)
+int harness::call_top()
+#else
 int main()
+#endif
 {
   auto result = top_call();
   if (!result) {
@@ -101,35 +134,44 @@ int main()
 // Add generated code below
 // =============================================================================
 
+
+#if defined(HOST_BENCHMARK)
+// Fail in the last frame of group 0 so the error crosses every frame
+const std::uint32_t harness::failing_threshold = 15;
+const harness::result_layout harness::layout =
+  harness::describe<error_t, decltype(top_call())>();
+#endif
+
+
 tl::expected<int, error_t> fallible_function0_group0();
-volatile int side_effect0 = 0;
+HARNESS_STATE volatile int side_effect0 = 0;
 
 tl::expected<int, error_t> fallible_function0_group1();
-volatile int side_effect1 = 0;
+HARNESS_STATE volatile int side_effect1 = 0;
 
 tl::expected<int, error_t> fallible_function0_group2();
-volatile int side_effect2 = 0;
+HARNESS_STATE volatile int side_effect2 = 0;
 
 tl::expected<int, error_t> fallible_function0_group3();
-volatile int side_effect3 = 0;
+HARNESS_STATE volatile int side_effect3 = 0;
 
 tl::expected<int, error_t> fallible_function0_group4();
-volatile int side_effect4 = 0;
+HARNESS_STATE volatile int side_effect4 = 0;
 
 tl::expected<int, error_t> fallible_function0_group5();
-volatile int side_effect5 = 0;
+HARNESS_STATE volatile int side_effect5 = 0;
 
 tl::expected<int, error_t> fallible_function0_group6();
-volatile int side_effect6 = 0;
+HARNESS_STATE volatile int side_effect6 = 0;
 
 tl::expected<int, error_t> fallible_function0_group7();
-volatile int side_effect7 = 0;
+HARNESS_STATE volatile int side_effect7 = 0;
 
 tl::expected<int, error_t> fallible_function0_group8();
-volatile int side_effect8 = 0;
+HARNESS_STATE volatile int side_effect8 = 0;
 
 tl::expected<int, error_t> fallible_function0_group9();
-volatile int side_effect9 = 0;
+HARNESS_STATE volatile int side_effect9 = 0;
 
 tl::expected<int, error_t> return_error()
 {
@@ -173,11 +215,10 @@ tl::expected<int, error_t> return_error()
   if (auto result = fallible_function0_group9(); !result) {
     return tl::unexpected(result.error());
   }
-  return side_effect0 + side_effect1 + side_effect2 + side_effect3 +
-         side_effect4 + side_effect5 + side_effect6 + side_effect7 +
-         side_effect8 + side_effect9;
+  return side_effect0+side_effect1+side_effect2+side_effect3+side_effect4+side_effect5+side_effect6+side_effect7+side_effect8+side_effect9;
 }
 
+
 tl::expected<int, error_t> fallible_function1_group0();
 
 tl::expected<int, error_t> fallible_function0_group0()
@@ -217,7 +258,7 @@ tl::expected<int, error_t> fallible_function2_group0();
 
 tl::expected<int, error_t> fallible_function1_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(1);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -228,7 +269,7 @@ tl::expected<int, error_t> fallible_function1_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(1);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -252,7 +293,7 @@ tl::expected<int, error_t> fallible_function3_group0();
 
 tl::expected<int, error_t> fallible_function2_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(2);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -263,7 +304,7 @@ tl::expected<int, error_t> fallible_function2_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(2);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -287,7 +328,7 @@ tl::expected<int, error_t> fallible_function4_group0();
 
 tl::expected<int, error_t> fallible_function3_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(3);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -298,7 +339,7 @@ tl::expected<int, error_t> fallible_function3_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(3);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -322,7 +363,7 @@ tl::expected<int, error_t> fallible_function5_group0();
 
 tl::expected<int, error_t> fallible_function4_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(4);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -333,7 +374,7 @@ tl::expected<int, error_t> fallible_function4_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(4);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -357,7 +398,7 @@ tl::expected<int, error_t> fallible_function6_group0();
 
 tl::expected<int, error_t> fallible_function5_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(5);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -368,7 +409,7 @@ tl::expected<int, error_t> fallible_function5_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(5);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -392,7 +433,7 @@ tl::expected<int, error_t> fallible_function7_group0();
 
 tl::expected<int, error_t> fallible_function6_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(6);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -403,7 +444,7 @@ tl::expected<int, error_t> fallible_function6_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(6);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -427,7 +468,7 @@ tl::expected<int, error_t> fallible_function8_group0();
 
 tl::expected<int, error_t> fallible_function7_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(7);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -438,7 +479,7 @@ tl::expected<int, error_t> fallible_function7_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(7);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -462,7 +503,7 @@ tl::expected<int, error_t> fallible_function9_group0();
 
 tl::expected<int, error_t> fallible_function8_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(8);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -473,7 +514,7 @@ tl::expected<int, error_t> fallible_function8_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(8);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -497,7 +538,7 @@ tl::expected<int, error_t> fallible_function10_group0();
 
 tl::expected<int, error_t> fallible_function9_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(9);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -508,7 +549,7 @@ tl::expected<int, error_t> fallible_function9_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(9);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -532,7 +573,7 @@ tl::expected<int, error_t> fallible_function11_group0();
 
 tl::expected<int, error_t> fallible_function10_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(10);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -543,7 +584,7 @@ tl::expected<int, error_t> fallible_function10_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(10);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -567,7 +608,7 @@ tl::expected<int, error_t> fallible_function12_group0();
 
 tl::expected<int, error_t> fallible_function11_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(11);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -578,7 +619,7 @@ tl::expected<int, error_t> fallible_function11_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(11);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -602,7 +643,7 @@ tl::expected<int, error_t> fallible_function13_group0();
 
 tl::expected<int, error_t> fallible_function12_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(12);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -613,7 +654,7 @@ tl::expected<int, error_t> fallible_function12_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(12);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -637,7 +678,7 @@ tl::expected<int, error_t> fallible_function14_group0();
 
 tl::expected<int, error_t> fallible_function13_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(13);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -648,7 +689,7 @@ tl::expected<int, error_t> fallible_function13_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(13);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -672,7 +713,7 @@ tl::expected<int, error_t> fallible_function15_group0();
 
 tl::expected<int, error_t> fallible_function14_group0()
 {
-  auto result_a = non_trivial_destructor::initialize(0);
+  auto result_a = non_trivial_destructor::initialize(14);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -683,7 +724,7 @@ tl::expected<int, error_t> fallible_function14_group0()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(0);
+  auto result_b = non_trivial_destructor::initialize(14);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -721,7 +762,7 @@ tl::expected<int, error_t> fallible_function1_group1();
 
 tl::expected<int, error_t> fallible_function0_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(0);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -732,7 +773,7 @@ tl::expected<int, error_t> fallible_function0_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(0);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -791,7 +832,7 @@ tl::expected<int, error_t> fallible_function3_group1();
 
 tl::expected<int, error_t> fallible_function2_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(2);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -802,7 +843,7 @@ tl::expected<int, error_t> fallible_function2_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(2);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -826,7 +867,7 @@ tl::expected<int, error_t> fallible_function4_group1();
 
 tl::expected<int, error_t> fallible_function3_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(3);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -837,7 +878,7 @@ tl::expected<int, error_t> fallible_function3_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(3);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -861,7 +902,7 @@ tl::expected<int, error_t> fallible_function5_group1();
 
 tl::expected<int, error_t> fallible_function4_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(4);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -872,7 +913,7 @@ tl::expected<int, error_t> fallible_function4_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(4);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -896,7 +937,7 @@ tl::expected<int, error_t> fallible_function6_group1();
 
 tl::expected<int, error_t> fallible_function5_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(5);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -907,7 +948,7 @@ tl::expected<int, error_t> fallible_function5_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(5);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -931,7 +972,7 @@ tl::expected<int, error_t> fallible_function7_group1();
 
 tl::expected<int, error_t> fallible_function6_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(6);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -942,7 +983,7 @@ tl::expected<int, error_t> fallible_function6_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(6);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -966,7 +1007,7 @@ tl::expected<int, error_t> fallible_function8_group1();
 
 tl::expected<int, error_t> fallible_function7_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(7);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -977,7 +1018,7 @@ tl::expected<int, error_t> fallible_function7_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(7);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1001,7 +1042,7 @@ tl::expected<int, error_t> fallible_function9_group1();
 
 tl::expected<int, error_t> fallible_function8_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(8);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1012,7 +1053,7 @@ tl::expected<int, error_t> fallible_function8_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(8);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1036,7 +1077,7 @@ tl::expected<int, error_t> fallible_function10_group1();
 
 tl::expected<int, error_t> fallible_function9_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(9);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1047,7 +1088,7 @@ tl::expected<int, error_t> fallible_function9_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(9);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1071,7 +1112,7 @@ tl::expected<int, error_t> fallible_function11_group1();
 
 tl::expected<int, error_t> fallible_function10_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(10);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1082,7 +1123,7 @@ tl::expected<int, error_t> fallible_function10_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(10);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1106,7 +1147,7 @@ tl::expected<int, error_t> fallible_function12_group1();
 
 tl::expected<int, error_t> fallible_function11_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(11);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1117,7 +1158,7 @@ tl::expected<int, error_t> fallible_function11_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(11);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1141,7 +1182,7 @@ tl::expected<int, error_t> fallible_function13_group1();
 
 tl::expected<int, error_t> fallible_function12_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(12);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1152,7 +1193,7 @@ tl::expected<int, error_t> fallible_function12_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(12);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1176,7 +1217,7 @@ tl::expected<int, error_t> fallible_function14_group1();
 
 tl::expected<int, error_t> fallible_function13_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(13);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1187,7 +1228,7 @@ tl::expected<int, error_t> fallible_function13_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(13);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1211,7 +1252,7 @@ tl::expected<int, error_t> fallible_function15_group1();
 
 tl::expected<int, error_t> fallible_function14_group1()
 {
-  auto result_a = non_trivial_destructor::initialize(1);
+  auto result_a = non_trivial_destructor::initialize(14);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1222,7 +1263,7 @@ tl::expected<int, error_t> fallible_function14_group1()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(1);
+  auto result_b = non_trivial_destructor::initialize(14);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1260,7 +1301,7 @@ tl::expected<int, error_t> fallible_function1_group2();
 
 tl::expected<int, error_t> fallible_function0_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(0);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1271,7 +1312,7 @@ tl::expected<int, error_t> fallible_function0_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(0);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1295,7 +1336,7 @@ tl::expected<int, error_t> fallible_function2_group2();
 
 tl::expected<int, error_t> fallible_function1_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(1);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1306,7 +1347,7 @@ tl::expected<int, error_t> fallible_function1_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(1);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1365,7 +1406,7 @@ tl::expected<int, error_t> fallible_function4_group2();
 
 tl::expected<int, error_t> fallible_function3_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(3);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1376,7 +1417,7 @@ tl::expected<int, error_t> fallible_function3_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(3);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1400,7 +1441,7 @@ tl::expected<int, error_t> fallible_function5_group2();
 
 tl::expected<int, error_t> fallible_function4_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(4);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1411,7 +1452,7 @@ tl::expected<int, error_t> fallible_function4_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(4);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1435,7 +1476,7 @@ tl::expected<int, error_t> fallible_function6_group2();
 
 tl::expected<int, error_t> fallible_function5_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(5);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1446,7 +1487,7 @@ tl::expected<int, error_t> fallible_function5_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(5);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1470,7 +1511,7 @@ tl::expected<int, error_t> fallible_function7_group2();
 
 tl::expected<int, error_t> fallible_function6_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(6);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1481,7 +1522,7 @@ tl::expected<int, error_t> fallible_function6_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(6);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1505,7 +1546,7 @@ tl::expected<int, error_t> fallible_function8_group2();
 
 tl::expected<int, error_t> fallible_function7_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(7);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1516,7 +1557,7 @@ tl::expected<int, error_t> fallible_function7_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(7);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1540,7 +1581,7 @@ tl::expected<int, error_t> fallible_function9_group2();
 
 tl::expected<int, error_t> fallible_function8_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(8);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1551,7 +1592,7 @@ tl::expected<int, error_t> fallible_function8_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(8);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1575,7 +1616,7 @@ tl::expected<int, error_t> fallible_function10_group2();
 
 tl::expected<int, error_t> fallible_function9_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(9);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1586,7 +1627,7 @@ tl::expected<int, error_t> fallible_function9_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(9);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1610,7 +1651,7 @@ tl::expected<int, error_t> fallible_function11_group2();
 
 tl::expected<int, error_t> fallible_function10_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(10);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1621,7 +1662,7 @@ tl::expected<int, error_t> fallible_function10_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(10);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1645,7 +1686,7 @@ tl::expected<int, error_t> fallible_function12_group2();
 
 tl::expected<int, error_t> fallible_function11_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(11);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1656,7 +1697,7 @@ tl::expected<int, error_t> fallible_function11_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(11);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1680,7 +1721,7 @@ tl::expected<int, error_t> fallible_function13_group2();
 
 tl::expected<int, error_t> fallible_function12_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(12);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1691,7 +1732,7 @@ tl::expected<int, error_t> fallible_function12_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(12);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1715,7 +1756,7 @@ tl::expected<int, error_t> fallible_function14_group2();
 
 tl::expected<int, error_t> fallible_function13_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(13);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1726,7 +1767,7 @@ tl::expected<int, error_t> fallible_function13_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(13);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1750,7 +1791,7 @@ tl::expected<int, error_t> fallible_function15_group2();
 
 tl::expected<int, error_t> fallible_function14_group2()
 {
-  auto result_a = non_trivial_destructor::initialize(2);
+  auto result_a = non_trivial_destructor::initialize(14);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1761,7 +1802,7 @@ tl::expected<int, error_t> fallible_function14_group2()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(2);
+  auto result_b = non_trivial_destructor::initialize(14);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1799,7 +1840,7 @@ tl::expected<int, error_t> fallible_function1_group3();
 
 tl::expected<int, error_t> fallible_function0_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(0);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1810,7 +1851,7 @@ tl::expected<int, error_t> fallible_function0_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(0);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1834,7 +1875,7 @@ tl::expected<int, error_t> fallible_function2_group3();
 
 tl::expected<int, error_t> fallible_function1_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(1);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1845,7 +1886,7 @@ tl::expected<int, error_t> fallible_function1_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(1);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1869,7 +1910,7 @@ tl::expected<int, error_t> fallible_function3_group3();
 
 tl::expected<int, error_t> fallible_function2_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(2);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1880,7 +1921,7 @@ tl::expected<int, error_t> fallible_function2_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(2);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1939,7 +1980,7 @@ tl::expected<int, error_t> fallible_function5_group3();
 
 tl::expected<int, error_t> fallible_function4_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(4);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1950,7 +1991,7 @@ tl::expected<int, error_t> fallible_function4_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(4);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -1974,7 +2015,7 @@ tl::expected<int, error_t> fallible_function6_group3();
 
 tl::expected<int, error_t> fallible_function5_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(5);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -1985,7 +2026,7 @@ tl::expected<int, error_t> fallible_function5_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(5);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2009,7 +2050,7 @@ tl::expected<int, error_t> fallible_function7_group3();
 
 tl::expected<int, error_t> fallible_function6_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(6);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2020,7 +2061,7 @@ tl::expected<int, error_t> fallible_function6_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(6);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2044,7 +2085,7 @@ tl::expected<int, error_t> fallible_function8_group3();
 
 tl::expected<int, error_t> fallible_function7_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(7);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2055,7 +2096,7 @@ tl::expected<int, error_t> fallible_function7_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(7);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2079,7 +2120,7 @@ tl::expected<int, error_t> fallible_function9_group3();
 
 tl::expected<int, error_t> fallible_function8_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(8);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2090,7 +2131,7 @@ tl::expected<int, error_t> fallible_function8_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(8);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2114,7 +2155,7 @@ tl::expected<int, error_t> fallible_function10_group3();
 
 tl::expected<int, error_t> fallible_function9_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(9);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2125,7 +2166,7 @@ tl::expected<int, error_t> fallible_function9_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(9);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2149,7 +2190,7 @@ tl::expected<int, error_t> fallible_function11_group3();
 
 tl::expected<int, error_t> fallible_function10_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(10);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2160,7 +2201,7 @@ tl::expected<int, error_t> fallible_function10_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(10);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2184,7 +2225,7 @@ tl::expected<int, error_t> fallible_function12_group3();
 
 tl::expected<int, error_t> fallible_function11_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(11);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2195,7 +2236,7 @@ tl::expected<int, error_t> fallible_function11_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(11);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2219,7 +2260,7 @@ tl::expected<int, error_t> fallible_function13_group3();
 
 tl::expected<int, error_t> fallible_function12_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(12);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2230,7 +2271,7 @@ tl::expected<int, error_t> fallible_function12_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(12);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2254,7 +2295,7 @@ tl::expected<int, error_t> fallible_function14_group3();
 
 tl::expected<int, error_t> fallible_function13_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(13);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2265,7 +2306,7 @@ tl::expected<int, error_t> fallible_function13_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(13);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2289,7 +2330,7 @@ tl::expected<int, error_t> fallible_function15_group3();
 
 tl::expected<int, error_t> fallible_function14_group3()
 {
-  auto result_a = non_trivial_destructor::initialize(3);
+  auto result_a = non_trivial_destructor::initialize(14);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2300,7 +2341,7 @@ tl::expected<int, error_t> fallible_function14_group3()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(3);
+  auto result_b = non_trivial_destructor::initialize(14);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2338,7 +2379,7 @@ tl::expected<int, error_t> fallible_function1_group4();
 
 tl::expected<int, error_t> fallible_function0_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(0);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2349,7 +2390,7 @@ tl::expected<int, error_t> fallible_function0_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(0);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2373,7 +2414,7 @@ tl::expected<int, error_t> fallible_function2_group4();
 
 tl::expected<int, error_t> fallible_function1_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(1);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2384,7 +2425,7 @@ tl::expected<int, error_t> fallible_function1_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(1);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2408,7 +2449,7 @@ tl::expected<int, error_t> fallible_function3_group4();
 
 tl::expected<int, error_t> fallible_function2_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(2);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2419,7 +2460,7 @@ tl::expected<int, error_t> fallible_function2_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(2);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2443,7 +2484,7 @@ tl::expected<int, error_t> fallible_function4_group4();
 
 tl::expected<int, error_t> fallible_function3_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(3);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2454,7 +2495,7 @@ tl::expected<int, error_t> fallible_function3_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(3);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2513,7 +2554,7 @@ tl::expected<int, error_t> fallible_function6_group4();
 
 tl::expected<int, error_t> fallible_function5_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(5);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2524,7 +2565,7 @@ tl::expected<int, error_t> fallible_function5_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(5);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2548,7 +2589,7 @@ tl::expected<int, error_t> fallible_function7_group4();
 
 tl::expected<int, error_t> fallible_function6_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(6);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2559,7 +2600,7 @@ tl::expected<int, error_t> fallible_function6_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(6);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2583,7 +2624,7 @@ tl::expected<int, error_t> fallible_function8_group4();
 
 tl::expected<int, error_t> fallible_function7_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(7);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2594,7 +2635,7 @@ tl::expected<int, error_t> fallible_function7_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(7);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2618,7 +2659,7 @@ tl::expected<int, error_t> fallible_function9_group4();
 
 tl::expected<int, error_t> fallible_function8_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(8);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2629,7 +2670,7 @@ tl::expected<int, error_t> fallible_function8_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(8);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2653,7 +2694,7 @@ tl::expected<int, error_t> fallible_function10_group4();
 
 tl::expected<int, error_t> fallible_function9_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(9);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2664,7 +2705,7 @@ tl::expected<int, error_t> fallible_function9_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(9);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2688,7 +2729,7 @@ tl::expected<int, error_t> fallible_function11_group4();
 
 tl::expected<int, error_t> fallible_function10_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(10);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2699,7 +2740,7 @@ tl::expected<int, error_t> fallible_function10_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(10);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2723,7 +2764,7 @@ tl::expected<int, error_t> fallible_function12_group4();
 
 tl::expected<int, error_t> fallible_function11_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(11);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2734,7 +2775,7 @@ tl::expected<int, error_t> fallible_function11_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(11);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2758,7 +2799,7 @@ tl::expected<int, error_t> fallible_function13_group4();
 
 tl::expected<int, error_t> fallible_function12_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(12);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2769,7 +2810,7 @@ tl::expected<int, error_t> fallible_function12_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(12);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2793,7 +2834,7 @@ tl::expected<int, error_t> fallible_function14_group4();
 
 tl::expected<int, error_t> fallible_function13_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(13);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2804,7 +2845,7 @@ tl::expected<int, error_t> fallible_function13_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(13);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2828,7 +2869,7 @@ tl::expected<int, error_t> fallible_function15_group4();
 
 tl::expected<int, error_t> fallible_function14_group4()
 {
-  auto result_a = non_trivial_destructor::initialize(4);
+  auto result_a = non_trivial_destructor::initialize(14);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2839,7 +2880,7 @@ tl::expected<int, error_t> fallible_function14_group4()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(4);
+  auto result_b = non_trivial_destructor::initialize(14);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2877,7 +2918,7 @@ tl::expected<int, error_t> fallible_function1_group5();
 
 tl::expected<int, error_t> fallible_function0_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(0);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2888,7 +2929,7 @@ tl::expected<int, error_t> fallible_function0_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(0);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2912,7 +2953,7 @@ tl::expected<int, error_t> fallible_function2_group5();
 
 tl::expected<int, error_t> fallible_function1_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(1);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2923,7 +2964,7 @@ tl::expected<int, error_t> fallible_function1_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(1);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2947,7 +2988,7 @@ tl::expected<int, error_t> fallible_function3_group5();
 
 tl::expected<int, error_t> fallible_function2_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(2);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2958,7 +2999,7 @@ tl::expected<int, error_t> fallible_function2_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(2);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -2982,7 +3023,7 @@ tl::expected<int, error_t> fallible_function4_group5();
 
 tl::expected<int, error_t> fallible_function3_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(3);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -2993,7 +3034,7 @@ tl::expected<int, error_t> fallible_function3_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(3);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3017,7 +3058,7 @@ tl::expected<int, error_t> fallible_function5_group5();
 
 tl::expected<int, error_t> fallible_function4_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(4);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3028,7 +3069,7 @@ tl::expected<int, error_t> fallible_function4_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(4);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3087,7 +3128,7 @@ tl::expected<int, error_t> fallible_function7_group5();
 
 tl::expected<int, error_t> fallible_function6_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(6);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3098,7 +3139,7 @@ tl::expected<int, error_t> fallible_function6_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(6);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3122,7 +3163,7 @@ tl::expected<int, error_t> fallible_function8_group5();
 
 tl::expected<int, error_t> fallible_function7_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(7);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3133,7 +3174,7 @@ tl::expected<int, error_t> fallible_function7_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(7);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3157,7 +3198,7 @@ tl::expected<int, error_t> fallible_function9_group5();
 
 tl::expected<int, error_t> fallible_function8_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(8);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3168,7 +3209,7 @@ tl::expected<int, error_t> fallible_function8_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(8);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3192,7 +3233,7 @@ tl::expected<int, error_t> fallible_function10_group5();
 
 tl::expected<int, error_t> fallible_function9_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(9);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3203,7 +3244,7 @@ tl::expected<int, error_t> fallible_function9_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(9);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3227,7 +3268,7 @@ tl::expected<int, error_t> fallible_function11_group5();
 
 tl::expected<int, error_t> fallible_function10_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(10);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3238,7 +3279,7 @@ tl::expected<int, error_t> fallible_function10_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(10);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3262,7 +3303,7 @@ tl::expected<int, error_t> fallible_function12_group5();
 
 tl::expected<int, error_t> fallible_function11_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(11);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3273,7 +3314,7 @@ tl::expected<int, error_t> fallible_function11_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(11);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3297,7 +3338,7 @@ tl::expected<int, error_t> fallible_function13_group5();
 
 tl::expected<int, error_t> fallible_function12_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(12);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3308,7 +3349,7 @@ tl::expected<int, error_t> fallible_function12_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(12);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3332,7 +3373,7 @@ tl::expected<int, error_t> fallible_function14_group5();
 
 tl::expected<int, error_t> fallible_function13_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(13);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3343,7 +3384,7 @@ tl::expected<int, error_t> fallible_function13_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(13);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3367,7 +3408,7 @@ tl::expected<int, error_t> fallible_function15_group5();
 
 tl::expected<int, error_t> fallible_function14_group5()
 {
-  auto result_a = non_trivial_destructor::initialize(5);
+  auto result_a = non_trivial_destructor::initialize(14);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3378,7 +3419,7 @@ tl::expected<int, error_t> fallible_function14_group5()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(5);
+  auto result_b = non_trivial_destructor::initialize(14);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3416,7 +3457,7 @@ tl::expected<int, error_t> fallible_function1_group6();
 
 tl::expected<int, error_t> fallible_function0_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(0);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3427,7 +3468,7 @@ tl::expected<int, error_t> fallible_function0_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(0);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3451,7 +3492,7 @@ tl::expected<int, error_t> fallible_function2_group6();
 
 tl::expected<int, error_t> fallible_function1_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(1);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3462,7 +3503,7 @@ tl::expected<int, error_t> fallible_function1_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(1);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3486,7 +3527,7 @@ tl::expected<int, error_t> fallible_function3_group6();
 
 tl::expected<int, error_t> fallible_function2_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(2);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3497,7 +3538,7 @@ tl::expected<int, error_t> fallible_function2_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(2);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3521,7 +3562,7 @@ tl::expected<int, error_t> fallible_function4_group6();
 
 tl::expected<int, error_t> fallible_function3_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(3);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3532,7 +3573,7 @@ tl::expected<int, error_t> fallible_function3_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(3);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3556,7 +3597,7 @@ tl::expected<int, error_t> fallible_function5_group6();
 
 tl::expected<int, error_t> fallible_function4_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(4);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3567,7 +3608,7 @@ tl::expected<int, error_t> fallible_function4_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(4);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3591,7 +3632,7 @@ tl::expected<int, error_t> fallible_function6_group6();
 
 tl::expected<int, error_t> fallible_function5_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(5);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3602,7 +3643,7 @@ tl::expected<int, error_t> fallible_function5_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(5);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3661,7 +3702,7 @@ tl::expected<int, error_t> fallible_function8_group6();
 
 tl::expected<int, error_t> fallible_function7_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(7);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3672,7 +3713,7 @@ tl::expected<int, error_t> fallible_function7_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(7);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3696,7 +3737,7 @@ tl::expected<int, error_t> fallible_function9_group6();
 
 tl::expected<int, error_t> fallible_function8_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(8);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3707,7 +3748,7 @@ tl::expected<int, error_t> fallible_function8_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(8);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3731,7 +3772,7 @@ tl::expected<int, error_t> fallible_function10_group6();
 
 tl::expected<int, error_t> fallible_function9_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(9);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3742,7 +3783,7 @@ tl::expected<int, error_t> fallible_function9_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(9);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3766,7 +3807,7 @@ tl::expected<int, error_t> fallible_function11_group6();
 
 tl::expected<int, error_t> fallible_function10_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(10);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3777,7 +3818,7 @@ tl::expected<int, error_t> fallible_function10_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(10);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3801,7 +3842,7 @@ tl::expected<int, error_t> fallible_function12_group6();
 
 tl::expected<int, error_t> fallible_function11_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(11);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3812,7 +3853,7 @@ tl::expected<int, error_t> fallible_function11_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(11);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3836,7 +3877,7 @@ tl::expected<int, error_t> fallible_function13_group6();
 
 tl::expected<int, error_t> fallible_function12_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(12);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3847,7 +3888,7 @@ tl::expected<int, error_t> fallible_function12_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(12);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3871,7 +3912,7 @@ tl::expected<int, error_t> fallible_function14_group6();
 
 tl::expected<int, error_t> fallible_function13_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(13);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3882,7 +3923,7 @@ tl::expected<int, error_t> fallible_function13_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(13);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3906,7 +3947,7 @@ tl::expected<int, error_t> fallible_function15_group6();
 
 tl::expected<int, error_t> fallible_function14_group6()
 {
-  auto result_a = non_trivial_destructor::initialize(6);
+  auto result_a = non_trivial_destructor::initialize(14);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3917,7 +3958,7 @@ tl::expected<int, error_t> fallible_function14_group6()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(6);
+  auto result_b = non_trivial_destructor::initialize(14);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3955,7 +3996,7 @@ tl::expected<int, error_t> fallible_function1_group7();
 
 tl::expected<int, error_t> fallible_function0_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(0);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -3966,7 +4007,7 @@ tl::expected<int, error_t> fallible_function0_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(0);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -3990,7 +4031,7 @@ tl::expected<int, error_t> fallible_function2_group7();
 
 tl::expected<int, error_t> fallible_function1_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(1);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4001,7 +4042,7 @@ tl::expected<int, error_t> fallible_function1_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(1);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4025,7 +4066,7 @@ tl::expected<int, error_t> fallible_function3_group7();
 
 tl::expected<int, error_t> fallible_function2_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(2);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4036,7 +4077,7 @@ tl::expected<int, error_t> fallible_function2_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(2);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4060,7 +4101,7 @@ tl::expected<int, error_t> fallible_function4_group7();
 
 tl::expected<int, error_t> fallible_function3_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(3);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4071,7 +4112,7 @@ tl::expected<int, error_t> fallible_function3_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(3);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4095,7 +4136,7 @@ tl::expected<int, error_t> fallible_function5_group7();
 
 tl::expected<int, error_t> fallible_function4_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(4);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4106,7 +4147,7 @@ tl::expected<int, error_t> fallible_function4_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(4);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4130,7 +4171,7 @@ tl::expected<int, error_t> fallible_function6_group7();
 
 tl::expected<int, error_t> fallible_function5_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(5);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4141,7 +4182,7 @@ tl::expected<int, error_t> fallible_function5_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(5);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4165,7 +4206,7 @@ tl::expected<int, error_t> fallible_function7_group7();
 
 tl::expected<int, error_t> fallible_function6_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(6);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4176,7 +4217,7 @@ tl::expected<int, error_t> fallible_function6_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(6);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4235,7 +4276,7 @@ tl::expected<int, error_t> fallible_function9_group7();
 
 tl::expected<int, error_t> fallible_function8_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(8);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4246,7 +4287,7 @@ tl::expected<int, error_t> fallible_function8_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(8);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4270,7 +4311,7 @@ tl::expected<int, error_t> fallible_function10_group7();
 
 tl::expected<int, error_t> fallible_function9_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(9);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4281,7 +4322,7 @@ tl::expected<int, error_t> fallible_function9_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(9);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4305,7 +4346,7 @@ tl::expected<int, error_t> fallible_function11_group7();
 
 tl::expected<int, error_t> fallible_function10_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(10);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4316,7 +4357,7 @@ tl::expected<int, error_t> fallible_function10_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(10);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4340,7 +4381,7 @@ tl::expected<int, error_t> fallible_function12_group7();
 
 tl::expected<int, error_t> fallible_function11_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(11);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4351,7 +4392,7 @@ tl::expected<int, error_t> fallible_function11_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(11);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4375,7 +4416,7 @@ tl::expected<int, error_t> fallible_function13_group7();
 
 tl::expected<int, error_t> fallible_function12_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(12);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4386,7 +4427,7 @@ tl::expected<int, error_t> fallible_function12_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(12);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4410,7 +4451,7 @@ tl::expected<int, error_t> fallible_function14_group7();
 
 tl::expected<int, error_t> fallible_function13_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(13);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4421,7 +4462,7 @@ tl::expected<int, error_t> fallible_function13_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(13);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4445,7 +4486,7 @@ tl::expected<int, error_t> fallible_function15_group7();
 
 tl::expected<int, error_t> fallible_function14_group7()
 {
-  auto result_a = non_trivial_destructor::initialize(7);
+  auto result_a = non_trivial_destructor::initialize(14);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4456,7 +4497,7 @@ tl::expected<int, error_t> fallible_function14_group7()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(7);
+  auto result_b = non_trivial_destructor::initialize(14);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4494,7 +4535,7 @@ tl::expected<int, error_t> fallible_function1_group8();
 
 tl::expected<int, error_t> fallible_function0_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(0);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4505,7 +4546,7 @@ tl::expected<int, error_t> fallible_function0_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(0);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4529,7 +4570,7 @@ tl::expected<int, error_t> fallible_function2_group8();
 
 tl::expected<int, error_t> fallible_function1_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(1);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4540,7 +4581,7 @@ tl::expected<int, error_t> fallible_function1_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(1);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4564,7 +4605,7 @@ tl::expected<int, error_t> fallible_function3_group8();
 
 tl::expected<int, error_t> fallible_function2_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(2);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4575,7 +4616,7 @@ tl::expected<int, error_t> fallible_function2_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(2);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4599,7 +4640,7 @@ tl::expected<int, error_t> fallible_function4_group8();
 
 tl::expected<int, error_t> fallible_function3_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(3);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4610,7 +4651,7 @@ tl::expected<int, error_t> fallible_function3_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(3);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4634,7 +4675,7 @@ tl::expected<int, error_t> fallible_function5_group8();
 
 tl::expected<int, error_t> fallible_function4_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(4);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4645,7 +4686,7 @@ tl::expected<int, error_t> fallible_function4_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(4);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4669,7 +4710,7 @@ tl::expected<int, error_t> fallible_function6_group8();
 
 tl::expected<int, error_t> fallible_function5_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(5);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4680,7 +4721,7 @@ tl::expected<int, error_t> fallible_function5_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(5);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4704,7 +4745,7 @@ tl::expected<int, error_t> fallible_function7_group8();
 
 tl::expected<int, error_t> fallible_function6_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(6);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4715,7 +4756,7 @@ tl::expected<int, error_t> fallible_function6_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(6);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4739,7 +4780,7 @@ tl::expected<int, error_t> fallible_function8_group8();
 
 tl::expected<int, error_t> fallible_function7_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(7);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4750,7 +4791,7 @@ tl::expected<int, error_t> fallible_function7_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(7);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4809,7 +4850,7 @@ tl::expected<int, error_t> fallible_function10_group8();
 
 tl::expected<int, error_t> fallible_function9_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(9);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4820,7 +4861,7 @@ tl::expected<int, error_t> fallible_function9_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(9);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4844,7 +4885,7 @@ tl::expected<int, error_t> fallible_function11_group8();
 
 tl::expected<int, error_t> fallible_function10_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(10);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4855,7 +4896,7 @@ tl::expected<int, error_t> fallible_function10_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(10);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4879,7 +4920,7 @@ tl::expected<int, error_t> fallible_function12_group8();
 
 tl::expected<int, error_t> fallible_function11_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(11);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4890,7 +4931,7 @@ tl::expected<int, error_t> fallible_function11_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(11);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4914,7 +4955,7 @@ tl::expected<int, error_t> fallible_function13_group8();
 
 tl::expected<int, error_t> fallible_function12_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(12);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4925,7 +4966,7 @@ tl::expected<int, error_t> fallible_function12_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(12);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4949,7 +4990,7 @@ tl::expected<int, error_t> fallible_function14_group8();
 
 tl::expected<int, error_t> fallible_function13_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(13);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4960,7 +5001,7 @@ tl::expected<int, error_t> fallible_function13_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(13);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -4984,7 +5025,7 @@ tl::expected<int, error_t> fallible_function15_group8();
 
 tl::expected<int, error_t> fallible_function14_group8()
 {
-  auto result_a = non_trivial_destructor::initialize(8);
+  auto result_a = non_trivial_destructor::initialize(14);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -4995,7 +5036,7 @@ tl::expected<int, error_t> fallible_function14_group8()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(8);
+  auto result_b = non_trivial_destructor::initialize(14);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5033,7 +5074,7 @@ tl::expected<int, error_t> fallible_function1_group9();
 
 tl::expected<int, error_t> fallible_function0_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(0);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5044,7 +5085,7 @@ tl::expected<int, error_t> fallible_function0_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(0);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5068,7 +5109,7 @@ tl::expected<int, error_t> fallible_function2_group9();
 
 tl::expected<int, error_t> fallible_function1_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(1);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5079,7 +5120,7 @@ tl::expected<int, error_t> fallible_function1_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(1);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5103,7 +5144,7 @@ tl::expected<int, error_t> fallible_function3_group9();
 
 tl::expected<int, error_t> fallible_function2_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(2);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5114,7 +5155,7 @@ tl::expected<int, error_t> fallible_function2_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(2);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5138,7 +5179,7 @@ tl::expected<int, error_t> fallible_function4_group9();
 
 tl::expected<int, error_t> fallible_function3_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(3);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5149,7 +5190,7 @@ tl::expected<int, error_t> fallible_function3_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(3);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5173,7 +5214,7 @@ tl::expected<int, error_t> fallible_function5_group9();
 
 tl::expected<int, error_t> fallible_function4_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(4);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5184,7 +5225,7 @@ tl::expected<int, error_t> fallible_function4_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(4);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5208,7 +5249,7 @@ tl::expected<int, error_t> fallible_function6_group9();
 
 tl::expected<int, error_t> fallible_function5_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(5);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5219,7 +5260,7 @@ tl::expected<int, error_t> fallible_function5_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(5);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5243,7 +5284,7 @@ tl::expected<int, error_t> fallible_function7_group9();
 
 tl::expected<int, error_t> fallible_function6_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(6);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5254,7 +5295,7 @@ tl::expected<int, error_t> fallible_function6_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(6);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5278,7 +5319,7 @@ tl::expected<int, error_t> fallible_function8_group9();
 
 tl::expected<int, error_t> fallible_function7_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(7);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5289,7 +5330,7 @@ tl::expected<int, error_t> fallible_function7_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(7);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5313,7 +5354,7 @@ tl::expected<int, error_t> fallible_function9_group9();
 
 tl::expected<int, error_t> fallible_function8_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(8);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5324,7 +5365,7 @@ tl::expected<int, error_t> fallible_function8_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(8);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5383,7 +5424,7 @@ tl::expected<int, error_t> fallible_function11_group9();
 
 tl::expected<int, error_t> fallible_function10_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(10);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5394,7 +5435,7 @@ tl::expected<int, error_t> fallible_function10_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(10);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5418,7 +5459,7 @@ tl::expected<int, error_t> fallible_function12_group9();
 
 tl::expected<int, error_t> fallible_function11_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(11);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5429,7 +5470,7 @@ tl::expected<int, error_t> fallible_function11_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(11);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5453,7 +5494,7 @@ tl::expected<int, error_t> fallible_function13_group9();
 
 tl::expected<int, error_t> fallible_function12_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(12);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5464,7 +5505,7 @@ tl::expected<int, error_t> fallible_function12_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(12);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5488,7 +5529,7 @@ tl::expected<int, error_t> fallible_function14_group9();
 
 tl::expected<int, error_t> fallible_function13_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(13);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5499,7 +5540,7 @@ tl::expected<int, error_t> fallible_function13_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(13);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5523,7 +5564,7 @@ tl::expected<int, error_t> fallible_function15_group9();
 
 tl::expected<int, error_t> fallible_function14_group9()
 {
-  auto result_a = non_trivial_destructor::initialize(9);
+  auto result_a = non_trivial_destructor::initialize(14);
 
   if (result_a) {
     auto result_internal = result_a.value().trigger();
@@ -5534,7 +5575,7 @@ tl::expected<int, error_t> fallible_function14_group9()
     return tl::unexpected(result_a.error());
   }
 
-  auto result_b = non_trivial_destructor::initialize(9);
+  auto result_b = non_trivial_destructor::initialize(14);
 
   if (result_b) {
     auto result_internal = result_b.value().trigger();
@@ -5567,3 +5608,4 @@ tl::expected<int, error_t> fallible_function15_group9()
 
   return side_effect9 + 1;
 }
+
@@ -0,0 +1,1380 @@
+
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <tl/expected.hpp>
+
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#else
+#define HARNESS_STATE
+#endif
+
+constexpr size_t error_size = 128;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
+constexpr uint32_t depth_before_exception = 1000;
+#endif
+
+struct error_t
+{
+  std::array<std::uint8_t, error_size> data;
+};
+
+HARNESS_STATE volatile std::uint64_t enable_register;
+HARNESS_STATE volatile std::uint64_t trigger_register;
+HARNESS_STATE volatile int side_effect = 0;
+HARNESS_STATE volatile int handled_errors = 0;
+
+class non_trivial_destructor
+{
+public:
+  static tl::expected<non_trivial_destructor, error_t> initialize(
+    uint32_t p_channel)
+  {
+    if (p_channel >= depth_before_exception) {
+      return tl::unexpected(error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } });
+    }
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
+    return non_trivial_destructor{ p_channel };
+  }
+
+  non_trivial_destructor(non_trivial_destructor&) = delete;
+  non_trivial_destructor& operator=(non_trivial_destructor&) = delete;
+  non_trivial_destructor(non_trivial_destructor&&) noexcept = default;
+  non_trivial_destructor& operator=(non_trivial_destructor&&) noexcept =
+    default;
+
+  tl::expected<void, error_t> trigger()
+  {
+    if (m_channel >= depth_before_exception) {
+      return tl::unexpected(error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } });
+    }
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
+
+    return {};
+  }
+
+  ~non_trivial_destructor()
+  {
+    enable_register =
+      enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
+  }
+
+private:
+  non_trivial_destructor(uint32_t p_channel)
+    : m_channel(p_channel)
+  {
+  }
+
+  uint32_t m_channel = 0;
+};
+
+tl::expected<int, error_t> return_error();
+tl::expected<int, error_t> top_call()
+{
+  auto result = return_error();
+  if (!result) {
+    return tl::unexpected(result.error());
+  }
+  return result.value();
+}
+
+#if defined(HOST_BENCHMARK)
+int harness::call_top()
+#else
+int main()
+#endif
+{
+  auto result = top_call();
+  if (!result) {
+    return static_cast<int>(result.error().data[0]);
+  }
+  return result.value();
+}
+
+// =============================================================================
+// Add generated code below
+// =============================================================================
+
+
+#if defined(HOST_BENCHMARK)
+// Fail in the last layer so the error starts in the deepest frames
+const std::uint32_t harness::failing_threshold = 15;
+const harness::result_layout harness::layout =
+  harness::describe<error_t, decltype(top_call())>();
+#endif
+
+tl::expected<int, error_t> fallible_helper0(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor::initialize(p_channel);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_helper1(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor::initialize(p_channel);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_helper2(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor::initialize(p_channel);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(p_channel);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_helper3(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor::initialize(p_channel);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_helper4(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor::initialize(p_channel);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(p_channel);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_helper5(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor::initialize(p_channel);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(p_channel);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_helper6(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor::initialize(p_channel);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(p_channel);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_helper7(std::uint32_t p_channel)
+{
+  auto object0 = non_trivial_destructor::initialize(p_channel);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(p_channel);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function15_group0()
+{
+  auto object0 = non_trivial_destructor::initialize(15);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(15);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper1(15); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function14_group0()
+{
+  if (auto result = fallible_function15_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper5(14); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function13_group0()
+{
+  auto object0 = non_trivial_destructor::initialize(13);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(13);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function14_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function12_group0()
+{
+  auto object0 = non_trivial_destructor::initialize(12);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function13_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    handled_errors = handled_errors + 1;
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function11_group0()
+{
+  for (int i = 0; i < 4; i++) {
+    if (auto result = fallible_helper5(11); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  if (auto result = fallible_function12_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    handled_errors = handled_errors + 1;
+  }
+  if (auto result = fallible_helper7(11); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function10_group0()
+{
+  auto object0 = non_trivial_destructor::initialize(10);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(10);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function11_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper6(10); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function9_group0()
+{
+  auto object0 = non_trivial_destructor::initialize(9);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(9);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function10_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function8_group0()
+{
+  if (auto result = fallible_function9_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper1(8); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  for (int i = 0; i < 2; i++) {
+    if (auto result = fallible_helper2(8); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function7_group0()
+{
+  auto object0 = non_trivial_destructor::initialize(7);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  for (int i = 0; i < 2; i++) {
+    if (auto result = fallible_helper3(7); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  if (auto result = fallible_function8_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function6_group0()
+{
+  auto object0 = non_trivial_destructor::initialize(6);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(6);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper1(6); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function7_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function6_group1()
+{
+  auto object0 = non_trivial_destructor::initialize(6);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(6);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  for (int i = 0; i < 4; i++) {
+    if (auto result = fallible_helper0(6); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  if (auto result = fallible_function7_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function5_group0()
+{
+  auto object0 = non_trivial_destructor::initialize(5);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(5);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function6_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    handled_errors = handled_errors + 1;
+  }
+  for (int i = 0; i < 2; i++) {
+    if (auto result = fallible_helper2(5); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function5_group1()
+{
+  if (auto result = fallible_function6_group1(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function5_group2()
+{
+  auto object0 = non_trivial_destructor::initialize(5);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(5);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper6(5); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function6_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper3(5); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function5_group3()
+{
+  auto object0 = non_trivial_destructor::initialize(5);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(5);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function6_group1(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function5_group4()
+{
+  auto object0 = non_trivial_destructor::initialize(5);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(5);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper4(5); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function6_group1(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function4_group0()
+{
+  if (auto result = fallible_function5_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function4_group1()
+{
+  if (auto result = fallible_function5_group1(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper1(4); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  for (int i = 0; i < 3; i++) {
+    if (auto result = fallible_helper4(4); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function4_group2()
+{
+  auto object0 = non_trivial_destructor::initialize(4);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function5_group2(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function4_group3()
+{
+  auto object0 = non_trivial_destructor::initialize(4);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper7(4); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper1(4); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function5_group3(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function4_group4()
+{
+  auto object0 = non_trivial_destructor::initialize(4);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(4);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function5_group4(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function3_group0()
+{
+  auto object0 = non_trivial_destructor::initialize(3);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function4_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function3_group1()
+{
+  auto object0 = non_trivial_destructor::initialize(3);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(3);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function4_group1(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper2(3); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function3_group2()
+{
+  auto object0 = non_trivial_destructor::initialize(3);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(3);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function4_group2(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  for (int i = 0; i < 4; i++) {
+    if (auto result = fallible_helper1(3); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function3_group3()
+{
+  for (int i = 0; i < 2; i++) {
+    if (auto result = fallible_helper1(3); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  if (auto result = fallible_helper7(3); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function4_group3(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function3_group4()
+{
+  auto object0 = non_trivial_destructor::initialize(3);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(3);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function4_group4(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function2_group0()
+{
+  auto object0 = non_trivial_destructor::initialize(2);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(2);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function3_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function2_group1()
+{
+  if (auto result = fallible_helper7(2); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper0(2); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function3_group1(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function2_group2()
+{
+  auto object0 = non_trivial_destructor::initialize(2);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(2);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function3_group2(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper0(2); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  for (int i = 0; i < 2; i++) {
+    if (auto result = fallible_helper3(2); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function2_group3()
+{
+  auto object0 = non_trivial_destructor::initialize(2);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(2);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function3_group3(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  for (int i = 0; i < 4; i++) {
+    if (auto result = fallible_helper6(2); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  if (auto result = fallible_helper3(2); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function2_group4()
+{
+  auto object0 = non_trivial_destructor::initialize(2);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper0(2); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function3_group4(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper5(2); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function1_group0()
+{
+  auto object0 = non_trivial_destructor::initialize(1);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper7(1); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper6(1); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function2_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function1_group1()
+{
+  auto object0 = non_trivial_destructor::initialize(1);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(1);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper6(1); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function2_group1(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper6(1); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function1_group2()
+{
+  auto object0 = non_trivial_destructor::initialize(1);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper3(1); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper1(1); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function2_group2(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function1_group3()
+{
+  auto object0 = non_trivial_destructor::initialize(1);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function2_group3(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper6(1); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function1_group4()
+{
+  auto object0 = non_trivial_destructor::initialize(1);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(1);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function2_group4(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function0_group0()
+{
+  if (auto result = fallible_function1_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function0_group1()
+{
+  for (int i = 0; i < 3; i++) {
+    if (auto result = fallible_helper1(0); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  if (auto result = fallible_function1_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  for (int i = 0; i < 4; i++) {
+    if (auto result = fallible_helper2(0); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function0_group2()
+{
+  auto object0 = non_trivial_destructor::initialize(0);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function1_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_helper4(0); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function0_group3()
+{
+  if (auto result = fallible_helper7(0); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  for (int i = 0; i < 3; i++) {
+    if (auto result = fallible_helper5(0); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  if (auto result = fallible_function1_group0(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function0_group4()
+{
+  auto object0 = non_trivial_destructor::initialize(0);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function1_group1(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    handled_errors = handled_errors + 1;
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function0_group5()
+{
+  auto object0 = non_trivial_destructor::initialize(0);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function1_group1(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  for (int i = 0; i < 4; i++) {
+    if (auto result = fallible_helper3(0); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function0_group6()
+{
+  auto object0 = non_trivial_destructor::initialize(0);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(0);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function1_group2(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function0_group7()
+{
+  if (auto result = fallible_function1_group1(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function0_group8()
+{
+  auto object0 = non_trivial_destructor::initialize(0);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  auto object1 = non_trivial_destructor::initialize(0);
+  if (!object1) {
+    return tl::unexpected(object1.error());
+  }
+  if (auto result = object1.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function1_group3(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> fallible_function0_group9()
+{
+  auto object0 = non_trivial_destructor::initialize(0);
+  if (!object0) {
+    return tl::unexpected(object0.error());
+  }
+  if (auto result = object0.value().trigger(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function1_group4(); result) {
+    side_effect = side_effect + result.value();
+  } else {
+    return tl::unexpected(result.error());
+  }
+  for (int i = 0; i < 4; i++) {
+    if (auto result = fallible_helper2(0); result) {
+      side_effect = side_effect + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+  }
+  return side_effect;
+}
+
+tl::expected<int, error_t> return_error()
+{
+  if (auto result = fallible_function0_group0(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function0_group1(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function0_group2(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function0_group3(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function0_group4(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function0_group5(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function0_group6(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function0_group7(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function0_group8(); !result) {
+    return tl::unexpected(result.error());
+  }
+  if (auto result = fallible_function0_group9(); !result) {
+    return tl::unexpected(result.error());
+  }
+  return side_effect;
+}
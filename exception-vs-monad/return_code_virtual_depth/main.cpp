@@ -0,0 +1,8097 @@
+
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <tl/expected.hpp>
+
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#else
+#define HARNESS_STATE
+#endif
+
+constexpr size_t error_size = 128;
+constexpr bool error_in_constructor = true;
+constexpr bool error_in_class_function = true;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
+constexpr uint32_t depth_before_exception = 1000;
+#endif
+
+struct error_t
+{
+  std::array<std::uint8_t, error_size> data;
+};
+
+HARNESS_STATE volatile std::uint64_t enable_register;
+HARNESS_STATE volatile std::uint64_t trigger_register;
+
+class non_trivial_destructor
+{
+public:
+  static tl::expected<non_trivial_destructor, error_t> initialize(
+    uint32_t p_channel)
+  {
+    if constexpr (error_in_constructor) {
+      if (p_channel >= depth_before_exception) {
+        return tl::unexpected(error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } });
+      }
+    }
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
+    return non_trivial_destructor{ p_channel };
+  }
+
+  non_trivial_destructor(non_trivial_destructor&) = delete;
+  non_trivial_destructor& operator=(non_trivial_destructor&) = delete;
+
+  // Taking the object out of a result moves it, and the moved-from one must
+  // not clear the channel the new one still holds when it is destroyed
+  non_trivial_destructor(non_trivial_destructor&& p_other) noexcept
+    : m_channel(std::exchange(p_other.m_channel, moved_from))
+  {
+  }
+
+  non_trivial_destructor& operator=(non_trivial_destructor&& p_other) noexcept
+  {
+    std::swap(m_channel, p_other.m_channel);
+    return *this;
+  }
+
+  tl::expected<void, error_t> trigger()
+  {
+    if constexpr (error_in_class_function) {
+      if (m_channel >= depth_before_exception) {
+        return tl::unexpected(error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } });
+      }
+    }
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
+
+    return {};
+  }
+
+  ~non_trivial_destructor()
+  {
+    if (m_channel != moved_from) {
+      enable_register =
+        enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
+    }
+  }
+
+private:
+  static constexpr uint32_t moved_from = UINT32_MAX;
+
+  non_trivial_destructor(uint32_t p_channel)
+    : m_channel(p_channel)
+  {
+  }
+
+  uint32_t m_channel = 0;
+};
+
+// Shaped like a libhal interface: the public function forwards to a private
+// virtual driver_*() function that every driver implements
+class fallible_driver
+{
+public:
+  tl::expected<int, error_t> call()
+  {
+    return driver_call();
+  }
+
+  virtual ~fallible_driver() = default;
+
+private:
+  virtual tl::expected<int, error_t> driver_call() = 0;
+};
+
+tl::expected<int, error_t> return_error();
+tl::expected<int, error_t> top_call()
+{
+  auto result = return_error();
+  if (!result) {
+    return tl::unexpected(result.error());
+  }
+  return result.value();
+}
+
+#if defined(HOST_BENCHMARK)
+int harness::call_top()
+#else
+int main()
+#endif
+{
+  auto result = top_call();
+  if (!result) {
+    return static_cast<int>(result.error().data[0]);
+  }
+  return result.value();
+}
+
+// =============================================================================
+// Add generated code below
+// =============================================================================
+
+
+#if defined(HOST_BENCHMARK)
+// Fail in the last frame of group 0 so the error crosses every frame
+const std::uint32_t harness::failing_threshold = 15;
+const harness::result_layout harness::layout =
+  harness::describe<error_t, decltype(top_call())>();
+#endif
+
+
+extern fallible_driver& driver0_group0;
+HARNESS_STATE volatile int side_effect0 = 0;
+
+extern fallible_driver& driver0_group1;
+HARNESS_STATE volatile int side_effect1 = 0;
+
+extern fallible_driver& driver0_group2;
+HARNESS_STATE volatile int side_effect2 = 0;
+
+extern fallible_driver& driver0_group3;
+HARNESS_STATE volatile int side_effect3 = 0;
+
+extern fallible_driver& driver0_group4;
+HARNESS_STATE volatile int side_effect4 = 0;
+
+extern fallible_driver& driver0_group5;
+HARNESS_STATE volatile int side_effect5 = 0;
+
+extern fallible_driver& driver0_group6;
+HARNESS_STATE volatile int side_effect6 = 0;
+
+extern fallible_driver& driver0_group7;
+HARNESS_STATE volatile int side_effect7 = 0;
+
+extern fallible_driver& driver0_group8;
+HARNESS_STATE volatile int side_effect8 = 0;
+
+extern fallible_driver& driver0_group9;
+HARNESS_STATE volatile int side_effect9 = 0;
+
+tl::expected<int, error_t> return_error()
+{
+
+  if (auto result = driver0_group0.call(); !result) {
+    return tl::unexpected(result.error());
+  }
+
+  if (auto result = driver0_group1.call(); !result) {
+    return tl::unexpected(result.error());
+  }
+
+  if (auto result = driver0_group2.call(); !result) {
+    return tl::unexpected(result.error());
+  }
+
+  if (auto result = driver0_group3.call(); !result) {
+    return tl::unexpected(result.error());
+  }
+
+  if (auto result = driver0_group4.call(); !result) {
+    return tl::unexpected(result.error());
+  }
+
+  if (auto result = driver0_group5.call(); !result) {
+    return tl::unexpected(result.error());
+  }
+
+  if (auto result = driver0_group6.call(); !result) {
+    return tl::unexpected(result.error());
+  }
+
+  if (auto result = driver0_group7.call(); !result) {
+    return tl::unexpected(result.error());
+  }
+
+  if (auto result = driver0_group8.call(); !result) {
+    return tl::unexpected(result.error());
+  }
+
+  if (auto result = driver0_group9.call(); !result) {
+    return tl::unexpected(result.error());
+  }
+  return side_effect0+side_effect1+side_effect2+side_effect3+side_effect4+side_effect5+side_effect6+side_effect7+side_effect8+side_effect9;
+}
+
+
+extern fallible_driver& driver1_group0;
+
+class fallible_function0_group0 final : public fallible_driver
+{
+public:
+  fallible_function0_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(0);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(0);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function0_group0 instance0_group0(
+  driver1_group0);
+fallible_driver& driver0_group0 = instance0_group0;
+
+extern fallible_driver& driver2_group0;
+
+class fallible_function1_group0 final : public fallible_driver
+{
+public:
+  fallible_function1_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(1);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(1);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function1_group0 instance1_group0(
+  driver2_group0);
+fallible_driver& driver1_group0 = instance1_group0;
+
+extern fallible_driver& driver3_group0;
+
+class fallible_function2_group0 final : public fallible_driver
+{
+public:
+  fallible_function2_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(2);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(2);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function2_group0 instance2_group0(
+  driver3_group0);
+fallible_driver& driver2_group0 = instance2_group0;
+
+extern fallible_driver& driver4_group0;
+
+class fallible_function3_group0 final : public fallible_driver
+{
+public:
+  fallible_function3_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(3);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(3);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function3_group0 instance3_group0(
+  driver4_group0);
+fallible_driver& driver3_group0 = instance3_group0;
+
+extern fallible_driver& driver5_group0;
+
+class fallible_function4_group0 final : public fallible_driver
+{
+public:
+  fallible_function4_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(4);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(4);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function4_group0 instance4_group0(
+  driver5_group0);
+fallible_driver& driver4_group0 = instance4_group0;
+
+extern fallible_driver& driver6_group0;
+
+class fallible_function5_group0 final : public fallible_driver
+{
+public:
+  fallible_function5_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(5);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(5);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function5_group0 instance5_group0(
+  driver6_group0);
+fallible_driver& driver5_group0 = instance5_group0;
+
+extern fallible_driver& driver7_group0;
+
+class fallible_function6_group0 final : public fallible_driver
+{
+public:
+  fallible_function6_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(6);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(6);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function6_group0 instance6_group0(
+  driver7_group0);
+fallible_driver& driver6_group0 = instance6_group0;
+
+extern fallible_driver& driver8_group0;
+
+class fallible_function7_group0 final : public fallible_driver
+{
+public:
+  fallible_function7_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(7);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(7);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function7_group0 instance7_group0(
+  driver8_group0);
+fallible_driver& driver7_group0 = instance7_group0;
+
+extern fallible_driver& driver9_group0;
+
+class fallible_function8_group0 final : public fallible_driver
+{
+public:
+  fallible_function8_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(8);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(8);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function8_group0 instance8_group0(
+  driver9_group0);
+fallible_driver& driver8_group0 = instance8_group0;
+
+extern fallible_driver& driver10_group0;
+
+class fallible_function9_group0 final : public fallible_driver
+{
+public:
+  fallible_function9_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(9);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(9);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function9_group0 instance9_group0(
+  driver10_group0);
+fallible_driver& driver9_group0 = instance9_group0;
+
+extern fallible_driver& driver11_group0;
+
+class fallible_function10_group0 final : public fallible_driver
+{
+public:
+  fallible_function10_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(10);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(10);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function10_group0 instance10_group0(
+  driver11_group0);
+fallible_driver& driver10_group0 = instance10_group0;
+
+extern fallible_driver& driver12_group0;
+
+class fallible_function11_group0 final : public fallible_driver
+{
+public:
+  fallible_function11_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(11);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(11);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function11_group0 instance11_group0(
+  driver12_group0);
+fallible_driver& driver11_group0 = instance11_group0;
+
+extern fallible_driver& driver13_group0;
+
+class fallible_function12_group0 final : public fallible_driver
+{
+public:
+  fallible_function12_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(12);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(12);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function12_group0 instance12_group0(
+  driver13_group0);
+fallible_driver& driver12_group0 = instance12_group0;
+
+extern fallible_driver& driver14_group0;
+
+class fallible_function13_group0 final : public fallible_driver
+{
+public:
+  fallible_function13_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(13);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(13);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function13_group0 instance13_group0(
+  driver14_group0);
+fallible_driver& driver13_group0 = instance13_group0;
+
+extern fallible_driver& driver15_group0;
+
+class fallible_function14_group0 final : public fallible_driver
+{
+public:
+  fallible_function14_group0(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(14);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(14);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect0 = side_effect0 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function14_group0 instance14_group0(
+  driver15_group0);
+fallible_driver& driver14_group0 = instance14_group0;
+
+class fallible_function15_group0 final : public fallible_driver
+{
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    if (auto result = non_trivial_destructor::initialize(15); result) {
+      auto result_internal = result.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect0 + 1;
+  }
+};
+
+static fallible_function15_group0 instance15_group0;
+fallible_driver& driver15_group0 = instance15_group0;
+
+extern fallible_driver& driver1_group1;
+
+class fallible_function0_group1 final : public fallible_driver
+{
+public:
+  fallible_function0_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(0);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(0);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function0_group1 instance0_group1(
+  driver1_group1);
+fallible_driver& driver0_group1 = instance0_group1;
+
+extern fallible_driver& driver2_group1;
+
+class fallible_function1_group1 final : public fallible_driver
+{
+public:
+  fallible_function1_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(1);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(1);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function1_group1 instance1_group1(
+  driver2_group1);
+fallible_driver& driver1_group1 = instance1_group1;
+
+extern fallible_driver& driver3_group1;
+
+class fallible_function2_group1 final : public fallible_driver
+{
+public:
+  fallible_function2_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(2);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(2);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function2_group1 instance2_group1(
+  driver3_group1);
+fallible_driver& driver2_group1 = instance2_group1;
+
+extern fallible_driver& driver4_group1;
+
+class fallible_function3_group1 final : public fallible_driver
+{
+public:
+  fallible_function3_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(3);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(3);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function3_group1 instance3_group1(
+  driver4_group1);
+fallible_driver& driver3_group1 = instance3_group1;
+
+extern fallible_driver& driver5_group1;
+
+class fallible_function4_group1 final : public fallible_driver
+{
+public:
+  fallible_function4_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(4);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(4);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function4_group1 instance4_group1(
+  driver5_group1);
+fallible_driver& driver4_group1 = instance4_group1;
+
+extern fallible_driver& driver6_group1;
+
+class fallible_function5_group1 final : public fallible_driver
+{
+public:
+  fallible_function5_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(5);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(5);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function5_group1 instance5_group1(
+  driver6_group1);
+fallible_driver& driver5_group1 = instance5_group1;
+
+extern fallible_driver& driver7_group1;
+
+class fallible_function6_group1 final : public fallible_driver
+{
+public:
+  fallible_function6_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(6);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(6);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function6_group1 instance6_group1(
+  driver7_group1);
+fallible_driver& driver6_group1 = instance6_group1;
+
+extern fallible_driver& driver8_group1;
+
+class fallible_function7_group1 final : public fallible_driver
+{
+public:
+  fallible_function7_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(7);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(7);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function7_group1 instance7_group1(
+  driver8_group1);
+fallible_driver& driver7_group1 = instance7_group1;
+
+extern fallible_driver& driver9_group1;
+
+class fallible_function8_group1 final : public fallible_driver
+{
+public:
+  fallible_function8_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(8);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(8);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function8_group1 instance8_group1(
+  driver9_group1);
+fallible_driver& driver8_group1 = instance8_group1;
+
+extern fallible_driver& driver10_group1;
+
+class fallible_function9_group1 final : public fallible_driver
+{
+public:
+  fallible_function9_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(9);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(9);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function9_group1 instance9_group1(
+  driver10_group1);
+fallible_driver& driver9_group1 = instance9_group1;
+
+extern fallible_driver& driver11_group1;
+
+class fallible_function10_group1 final : public fallible_driver
+{
+public:
+  fallible_function10_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(10);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(10);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function10_group1 instance10_group1(
+  driver11_group1);
+fallible_driver& driver10_group1 = instance10_group1;
+
+extern fallible_driver& driver12_group1;
+
+class fallible_function11_group1 final : public fallible_driver
+{
+public:
+  fallible_function11_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(11);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(11);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function11_group1 instance11_group1(
+  driver12_group1);
+fallible_driver& driver11_group1 = instance11_group1;
+
+extern fallible_driver& driver13_group1;
+
+class fallible_function12_group1 final : public fallible_driver
+{
+public:
+  fallible_function12_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(12);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(12);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function12_group1 instance12_group1(
+  driver13_group1);
+fallible_driver& driver12_group1 = instance12_group1;
+
+extern fallible_driver& driver14_group1;
+
+class fallible_function13_group1 final : public fallible_driver
+{
+public:
+  fallible_function13_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(13);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(13);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function13_group1 instance13_group1(
+  driver14_group1);
+fallible_driver& driver13_group1 = instance13_group1;
+
+extern fallible_driver& driver15_group1;
+
+class fallible_function14_group1 final : public fallible_driver
+{
+public:
+  fallible_function14_group1(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(14);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(14);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect1 = side_effect1 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function14_group1 instance14_group1(
+  driver15_group1);
+fallible_driver& driver14_group1 = instance14_group1;
+
+class fallible_function15_group1 final : public fallible_driver
+{
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    if (auto result = non_trivial_destructor::initialize(15); result) {
+      auto result_internal = result.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect1 + 1;
+  }
+};
+
+static fallible_function15_group1 instance15_group1;
+fallible_driver& driver15_group1 = instance15_group1;
+
+extern fallible_driver& driver1_group2;
+
+class fallible_function0_group2 final : public fallible_driver
+{
+public:
+  fallible_function0_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(0);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(0);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function0_group2 instance0_group2(
+  driver1_group2);
+fallible_driver& driver0_group2 = instance0_group2;
+
+extern fallible_driver& driver2_group2;
+
+class fallible_function1_group2 final : public fallible_driver
+{
+public:
+  fallible_function1_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(1);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(1);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function1_group2 instance1_group2(
+  driver2_group2);
+fallible_driver& driver1_group2 = instance1_group2;
+
+extern fallible_driver& driver3_group2;
+
+class fallible_function2_group2 final : public fallible_driver
+{
+public:
+  fallible_function2_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(2);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(2);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function2_group2 instance2_group2(
+  driver3_group2);
+fallible_driver& driver2_group2 = instance2_group2;
+
+extern fallible_driver& driver4_group2;
+
+class fallible_function3_group2 final : public fallible_driver
+{
+public:
+  fallible_function3_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(3);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(3);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function3_group2 instance3_group2(
+  driver4_group2);
+fallible_driver& driver3_group2 = instance3_group2;
+
+extern fallible_driver& driver5_group2;
+
+class fallible_function4_group2 final : public fallible_driver
+{
+public:
+  fallible_function4_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(4);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(4);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function4_group2 instance4_group2(
+  driver5_group2);
+fallible_driver& driver4_group2 = instance4_group2;
+
+extern fallible_driver& driver6_group2;
+
+class fallible_function5_group2 final : public fallible_driver
+{
+public:
+  fallible_function5_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(5);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(5);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function5_group2 instance5_group2(
+  driver6_group2);
+fallible_driver& driver5_group2 = instance5_group2;
+
+extern fallible_driver& driver7_group2;
+
+class fallible_function6_group2 final : public fallible_driver
+{
+public:
+  fallible_function6_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(6);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(6);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function6_group2 instance6_group2(
+  driver7_group2);
+fallible_driver& driver6_group2 = instance6_group2;
+
+extern fallible_driver& driver8_group2;
+
+class fallible_function7_group2 final : public fallible_driver
+{
+public:
+  fallible_function7_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(7);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(7);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function7_group2 instance7_group2(
+  driver8_group2);
+fallible_driver& driver7_group2 = instance7_group2;
+
+extern fallible_driver& driver9_group2;
+
+class fallible_function8_group2 final : public fallible_driver
+{
+public:
+  fallible_function8_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(8);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(8);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function8_group2 instance8_group2(
+  driver9_group2);
+fallible_driver& driver8_group2 = instance8_group2;
+
+extern fallible_driver& driver10_group2;
+
+class fallible_function9_group2 final : public fallible_driver
+{
+public:
+  fallible_function9_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(9);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(9);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function9_group2 instance9_group2(
+  driver10_group2);
+fallible_driver& driver9_group2 = instance9_group2;
+
+extern fallible_driver& driver11_group2;
+
+class fallible_function10_group2 final : public fallible_driver
+{
+public:
+  fallible_function10_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(10);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(10);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function10_group2 instance10_group2(
+  driver11_group2);
+fallible_driver& driver10_group2 = instance10_group2;
+
+extern fallible_driver& driver12_group2;
+
+class fallible_function11_group2 final : public fallible_driver
+{
+public:
+  fallible_function11_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(11);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(11);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function11_group2 instance11_group2(
+  driver12_group2);
+fallible_driver& driver11_group2 = instance11_group2;
+
+extern fallible_driver& driver13_group2;
+
+class fallible_function12_group2 final : public fallible_driver
+{
+public:
+  fallible_function12_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(12);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(12);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function12_group2 instance12_group2(
+  driver13_group2);
+fallible_driver& driver12_group2 = instance12_group2;
+
+extern fallible_driver& driver14_group2;
+
+class fallible_function13_group2 final : public fallible_driver
+{
+public:
+  fallible_function13_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(13);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(13);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function13_group2 instance13_group2(
+  driver14_group2);
+fallible_driver& driver13_group2 = instance13_group2;
+
+extern fallible_driver& driver15_group2;
+
+class fallible_function14_group2 final : public fallible_driver
+{
+public:
+  fallible_function14_group2(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(14);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(14);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect2 = side_effect2 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function14_group2 instance14_group2(
+  driver15_group2);
+fallible_driver& driver14_group2 = instance14_group2;
+
+class fallible_function15_group2 final : public fallible_driver
+{
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    if (auto result = non_trivial_destructor::initialize(15); result) {
+      auto result_internal = result.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect2 + 1;
+  }
+};
+
+static fallible_function15_group2 instance15_group2;
+fallible_driver& driver15_group2 = instance15_group2;
+
+extern fallible_driver& driver1_group3;
+
+class fallible_function0_group3 final : public fallible_driver
+{
+public:
+  fallible_function0_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(0);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(0);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function0_group3 instance0_group3(
+  driver1_group3);
+fallible_driver& driver0_group3 = instance0_group3;
+
+extern fallible_driver& driver2_group3;
+
+class fallible_function1_group3 final : public fallible_driver
+{
+public:
+  fallible_function1_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(1);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(1);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function1_group3 instance1_group3(
+  driver2_group3);
+fallible_driver& driver1_group3 = instance1_group3;
+
+extern fallible_driver& driver3_group3;
+
+class fallible_function2_group3 final : public fallible_driver
+{
+public:
+  fallible_function2_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(2);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(2);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function2_group3 instance2_group3(
+  driver3_group3);
+fallible_driver& driver2_group3 = instance2_group3;
+
+extern fallible_driver& driver4_group3;
+
+class fallible_function3_group3 final : public fallible_driver
+{
+public:
+  fallible_function3_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(3);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(3);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function3_group3 instance3_group3(
+  driver4_group3);
+fallible_driver& driver3_group3 = instance3_group3;
+
+extern fallible_driver& driver5_group3;
+
+class fallible_function4_group3 final : public fallible_driver
+{
+public:
+  fallible_function4_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(4);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(4);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function4_group3 instance4_group3(
+  driver5_group3);
+fallible_driver& driver4_group3 = instance4_group3;
+
+extern fallible_driver& driver6_group3;
+
+class fallible_function5_group3 final : public fallible_driver
+{
+public:
+  fallible_function5_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(5);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(5);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function5_group3 instance5_group3(
+  driver6_group3);
+fallible_driver& driver5_group3 = instance5_group3;
+
+extern fallible_driver& driver7_group3;
+
+class fallible_function6_group3 final : public fallible_driver
+{
+public:
+  fallible_function6_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(6);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(6);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function6_group3 instance6_group3(
+  driver7_group3);
+fallible_driver& driver6_group3 = instance6_group3;
+
+extern fallible_driver& driver8_group3;
+
+class fallible_function7_group3 final : public fallible_driver
+{
+public:
+  fallible_function7_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(7);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(7);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function7_group3 instance7_group3(
+  driver8_group3);
+fallible_driver& driver7_group3 = instance7_group3;
+
+extern fallible_driver& driver9_group3;
+
+class fallible_function8_group3 final : public fallible_driver
+{
+public:
+  fallible_function8_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(8);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(8);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function8_group3 instance8_group3(
+  driver9_group3);
+fallible_driver& driver8_group3 = instance8_group3;
+
+extern fallible_driver& driver10_group3;
+
+class fallible_function9_group3 final : public fallible_driver
+{
+public:
+  fallible_function9_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(9);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(9);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function9_group3 instance9_group3(
+  driver10_group3);
+fallible_driver& driver9_group3 = instance9_group3;
+
+extern fallible_driver& driver11_group3;
+
+class fallible_function10_group3 final : public fallible_driver
+{
+public:
+  fallible_function10_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(10);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(10);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function10_group3 instance10_group3(
+  driver11_group3);
+fallible_driver& driver10_group3 = instance10_group3;
+
+extern fallible_driver& driver12_group3;
+
+class fallible_function11_group3 final : public fallible_driver
+{
+public:
+  fallible_function11_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(11);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(11);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function11_group3 instance11_group3(
+  driver12_group3);
+fallible_driver& driver11_group3 = instance11_group3;
+
+extern fallible_driver& driver13_group3;
+
+class fallible_function12_group3 final : public fallible_driver
+{
+public:
+  fallible_function12_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(12);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(12);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function12_group3 instance12_group3(
+  driver13_group3);
+fallible_driver& driver12_group3 = instance12_group3;
+
+extern fallible_driver& driver14_group3;
+
+class fallible_function13_group3 final : public fallible_driver
+{
+public:
+  fallible_function13_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(13);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(13);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function13_group3 instance13_group3(
+  driver14_group3);
+fallible_driver& driver13_group3 = instance13_group3;
+
+extern fallible_driver& driver15_group3;
+
+class fallible_function14_group3 final : public fallible_driver
+{
+public:
+  fallible_function14_group3(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(14);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(14);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect3 = side_effect3 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function14_group3 instance14_group3(
+  driver15_group3);
+fallible_driver& driver14_group3 = instance14_group3;
+
+class fallible_function15_group3 final : public fallible_driver
+{
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    if (auto result = non_trivial_destructor::initialize(15); result) {
+      auto result_internal = result.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect3 + 1;
+  }
+};
+
+static fallible_function15_group3 instance15_group3;
+fallible_driver& driver15_group3 = instance15_group3;
+
+extern fallible_driver& driver1_group4;
+
+class fallible_function0_group4 final : public fallible_driver
+{
+public:
+  fallible_function0_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(0);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(0);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function0_group4 instance0_group4(
+  driver1_group4);
+fallible_driver& driver0_group4 = instance0_group4;
+
+extern fallible_driver& driver2_group4;
+
+class fallible_function1_group4 final : public fallible_driver
+{
+public:
+  fallible_function1_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(1);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(1);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function1_group4 instance1_group4(
+  driver2_group4);
+fallible_driver& driver1_group4 = instance1_group4;
+
+extern fallible_driver& driver3_group4;
+
+class fallible_function2_group4 final : public fallible_driver
+{
+public:
+  fallible_function2_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(2);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(2);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function2_group4 instance2_group4(
+  driver3_group4);
+fallible_driver& driver2_group4 = instance2_group4;
+
+extern fallible_driver& driver4_group4;
+
+class fallible_function3_group4 final : public fallible_driver
+{
+public:
+  fallible_function3_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(3);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(3);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function3_group4 instance3_group4(
+  driver4_group4);
+fallible_driver& driver3_group4 = instance3_group4;
+
+extern fallible_driver& driver5_group4;
+
+class fallible_function4_group4 final : public fallible_driver
+{
+public:
+  fallible_function4_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(4);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(4);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function4_group4 instance4_group4(
+  driver5_group4);
+fallible_driver& driver4_group4 = instance4_group4;
+
+extern fallible_driver& driver6_group4;
+
+class fallible_function5_group4 final : public fallible_driver
+{
+public:
+  fallible_function5_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(5);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(5);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function5_group4 instance5_group4(
+  driver6_group4);
+fallible_driver& driver5_group4 = instance5_group4;
+
+extern fallible_driver& driver7_group4;
+
+class fallible_function6_group4 final : public fallible_driver
+{
+public:
+  fallible_function6_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(6);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(6);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function6_group4 instance6_group4(
+  driver7_group4);
+fallible_driver& driver6_group4 = instance6_group4;
+
+extern fallible_driver& driver8_group4;
+
+class fallible_function7_group4 final : public fallible_driver
+{
+public:
+  fallible_function7_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(7);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(7);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function7_group4 instance7_group4(
+  driver8_group4);
+fallible_driver& driver7_group4 = instance7_group4;
+
+extern fallible_driver& driver9_group4;
+
+class fallible_function8_group4 final : public fallible_driver
+{
+public:
+  fallible_function8_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(8);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(8);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function8_group4 instance8_group4(
+  driver9_group4);
+fallible_driver& driver8_group4 = instance8_group4;
+
+extern fallible_driver& driver10_group4;
+
+class fallible_function9_group4 final : public fallible_driver
+{
+public:
+  fallible_function9_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(9);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(9);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function9_group4 instance9_group4(
+  driver10_group4);
+fallible_driver& driver9_group4 = instance9_group4;
+
+extern fallible_driver& driver11_group4;
+
+class fallible_function10_group4 final : public fallible_driver
+{
+public:
+  fallible_function10_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(10);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(10);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function10_group4 instance10_group4(
+  driver11_group4);
+fallible_driver& driver10_group4 = instance10_group4;
+
+extern fallible_driver& driver12_group4;
+
+class fallible_function11_group4 final : public fallible_driver
+{
+public:
+  fallible_function11_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(11);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(11);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function11_group4 instance11_group4(
+  driver12_group4);
+fallible_driver& driver11_group4 = instance11_group4;
+
+extern fallible_driver& driver13_group4;
+
+class fallible_function12_group4 final : public fallible_driver
+{
+public:
+  fallible_function12_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(12);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(12);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function12_group4 instance12_group4(
+  driver13_group4);
+fallible_driver& driver12_group4 = instance12_group4;
+
+extern fallible_driver& driver14_group4;
+
+class fallible_function13_group4 final : public fallible_driver
+{
+public:
+  fallible_function13_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(13);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(13);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function13_group4 instance13_group4(
+  driver14_group4);
+fallible_driver& driver13_group4 = instance13_group4;
+
+extern fallible_driver& driver15_group4;
+
+class fallible_function14_group4 final : public fallible_driver
+{
+public:
+  fallible_function14_group4(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(14);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(14);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect4 = side_effect4 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function14_group4 instance14_group4(
+  driver15_group4);
+fallible_driver& driver14_group4 = instance14_group4;
+
+class fallible_function15_group4 final : public fallible_driver
+{
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    if (auto result = non_trivial_destructor::initialize(15); result) {
+      auto result_internal = result.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect4 + 1;
+  }
+};
+
+static fallible_function15_group4 instance15_group4;
+fallible_driver& driver15_group4 = instance15_group4;
+
+extern fallible_driver& driver1_group5;
+
+class fallible_function0_group5 final : public fallible_driver
+{
+public:
+  fallible_function0_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(0);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(0);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function0_group5 instance0_group5(
+  driver1_group5);
+fallible_driver& driver0_group5 = instance0_group5;
+
+extern fallible_driver& driver2_group5;
+
+class fallible_function1_group5 final : public fallible_driver
+{
+public:
+  fallible_function1_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(1);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(1);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function1_group5 instance1_group5(
+  driver2_group5);
+fallible_driver& driver1_group5 = instance1_group5;
+
+extern fallible_driver& driver3_group5;
+
+class fallible_function2_group5 final : public fallible_driver
+{
+public:
+  fallible_function2_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(2);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(2);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function2_group5 instance2_group5(
+  driver3_group5);
+fallible_driver& driver2_group5 = instance2_group5;
+
+extern fallible_driver& driver4_group5;
+
+class fallible_function3_group5 final : public fallible_driver
+{
+public:
+  fallible_function3_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(3);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(3);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function3_group5 instance3_group5(
+  driver4_group5);
+fallible_driver& driver3_group5 = instance3_group5;
+
+extern fallible_driver& driver5_group5;
+
+class fallible_function4_group5 final : public fallible_driver
+{
+public:
+  fallible_function4_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(4);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(4);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function4_group5 instance4_group5(
+  driver5_group5);
+fallible_driver& driver4_group5 = instance4_group5;
+
+extern fallible_driver& driver6_group5;
+
+class fallible_function5_group5 final : public fallible_driver
+{
+public:
+  fallible_function5_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(5);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(5);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function5_group5 instance5_group5(
+  driver6_group5);
+fallible_driver& driver5_group5 = instance5_group5;
+
+extern fallible_driver& driver7_group5;
+
+class fallible_function6_group5 final : public fallible_driver
+{
+public:
+  fallible_function6_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(6);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(6);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function6_group5 instance6_group5(
+  driver7_group5);
+fallible_driver& driver6_group5 = instance6_group5;
+
+extern fallible_driver& driver8_group5;
+
+class fallible_function7_group5 final : public fallible_driver
+{
+public:
+  fallible_function7_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(7);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(7);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function7_group5 instance7_group5(
+  driver8_group5);
+fallible_driver& driver7_group5 = instance7_group5;
+
+extern fallible_driver& driver9_group5;
+
+class fallible_function8_group5 final : public fallible_driver
+{
+public:
+  fallible_function8_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(8);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(8);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function8_group5 instance8_group5(
+  driver9_group5);
+fallible_driver& driver8_group5 = instance8_group5;
+
+extern fallible_driver& driver10_group5;
+
+class fallible_function9_group5 final : public fallible_driver
+{
+public:
+  fallible_function9_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(9);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(9);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function9_group5 instance9_group5(
+  driver10_group5);
+fallible_driver& driver9_group5 = instance9_group5;
+
+extern fallible_driver& driver11_group5;
+
+class fallible_function10_group5 final : public fallible_driver
+{
+public:
+  fallible_function10_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(10);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(10);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function10_group5 instance10_group5(
+  driver11_group5);
+fallible_driver& driver10_group5 = instance10_group5;
+
+extern fallible_driver& driver12_group5;
+
+class fallible_function11_group5 final : public fallible_driver
+{
+public:
+  fallible_function11_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(11);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(11);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function11_group5 instance11_group5(
+  driver12_group5);
+fallible_driver& driver11_group5 = instance11_group5;
+
+extern fallible_driver& driver13_group5;
+
+class fallible_function12_group5 final : public fallible_driver
+{
+public:
+  fallible_function12_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(12);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(12);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function12_group5 instance12_group5(
+  driver13_group5);
+fallible_driver& driver12_group5 = instance12_group5;
+
+extern fallible_driver& driver14_group5;
+
+class fallible_function13_group5 final : public fallible_driver
+{
+public:
+  fallible_function13_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(13);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(13);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function13_group5 instance13_group5(
+  driver14_group5);
+fallible_driver& driver13_group5 = instance13_group5;
+
+extern fallible_driver& driver15_group5;
+
+class fallible_function14_group5 final : public fallible_driver
+{
+public:
+  fallible_function14_group5(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(14);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(14);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect5 = side_effect5 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function14_group5 instance14_group5(
+  driver15_group5);
+fallible_driver& driver14_group5 = instance14_group5;
+
+class fallible_function15_group5 final : public fallible_driver
+{
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    if (auto result = non_trivial_destructor::initialize(15); result) {
+      auto result_internal = result.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect5 + 1;
+  }
+};
+
+static fallible_function15_group5 instance15_group5;
+fallible_driver& driver15_group5 = instance15_group5;
+
+extern fallible_driver& driver1_group6;
+
+class fallible_function0_group6 final : public fallible_driver
+{
+public:
+  fallible_function0_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(0);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(0);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function0_group6 instance0_group6(
+  driver1_group6);
+fallible_driver& driver0_group6 = instance0_group6;
+
+extern fallible_driver& driver2_group6;
+
+class fallible_function1_group6 final : public fallible_driver
+{
+public:
+  fallible_function1_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(1);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(1);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function1_group6 instance1_group6(
+  driver2_group6);
+fallible_driver& driver1_group6 = instance1_group6;
+
+extern fallible_driver& driver3_group6;
+
+class fallible_function2_group6 final : public fallible_driver
+{
+public:
+  fallible_function2_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(2);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(2);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function2_group6 instance2_group6(
+  driver3_group6);
+fallible_driver& driver2_group6 = instance2_group6;
+
+extern fallible_driver& driver4_group6;
+
+class fallible_function3_group6 final : public fallible_driver
+{
+public:
+  fallible_function3_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(3);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(3);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function3_group6 instance3_group6(
+  driver4_group6);
+fallible_driver& driver3_group6 = instance3_group6;
+
+extern fallible_driver& driver5_group6;
+
+class fallible_function4_group6 final : public fallible_driver
+{
+public:
+  fallible_function4_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(4);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(4);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function4_group6 instance4_group6(
+  driver5_group6);
+fallible_driver& driver4_group6 = instance4_group6;
+
+extern fallible_driver& driver6_group6;
+
+class fallible_function5_group6 final : public fallible_driver
+{
+public:
+  fallible_function5_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(5);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(5);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function5_group6 instance5_group6(
+  driver6_group6);
+fallible_driver& driver5_group6 = instance5_group6;
+
+extern fallible_driver& driver7_group6;
+
+class fallible_function6_group6 final : public fallible_driver
+{
+public:
+  fallible_function6_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(6);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(6);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function6_group6 instance6_group6(
+  driver7_group6);
+fallible_driver& driver6_group6 = instance6_group6;
+
+extern fallible_driver& driver8_group6;
+
+class fallible_function7_group6 final : public fallible_driver
+{
+public:
+  fallible_function7_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(7);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(7);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function7_group6 instance7_group6(
+  driver8_group6);
+fallible_driver& driver7_group6 = instance7_group6;
+
+extern fallible_driver& driver9_group6;
+
+class fallible_function8_group6 final : public fallible_driver
+{
+public:
+  fallible_function8_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(8);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(8);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function8_group6 instance8_group6(
+  driver9_group6);
+fallible_driver& driver8_group6 = instance8_group6;
+
+extern fallible_driver& driver10_group6;
+
+class fallible_function9_group6 final : public fallible_driver
+{
+public:
+  fallible_function9_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(9);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(9);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function9_group6 instance9_group6(
+  driver10_group6);
+fallible_driver& driver9_group6 = instance9_group6;
+
+extern fallible_driver& driver11_group6;
+
+class fallible_function10_group6 final : public fallible_driver
+{
+public:
+  fallible_function10_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(10);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(10);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function10_group6 instance10_group6(
+  driver11_group6);
+fallible_driver& driver10_group6 = instance10_group6;
+
+extern fallible_driver& driver12_group6;
+
+class fallible_function11_group6 final : public fallible_driver
+{
+public:
+  fallible_function11_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(11);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(11);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function11_group6 instance11_group6(
+  driver12_group6);
+fallible_driver& driver11_group6 = instance11_group6;
+
+extern fallible_driver& driver13_group6;
+
+class fallible_function12_group6 final : public fallible_driver
+{
+public:
+  fallible_function12_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(12);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(12);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function12_group6 instance12_group6(
+  driver13_group6);
+fallible_driver& driver12_group6 = instance12_group6;
+
+extern fallible_driver& driver14_group6;
+
+class fallible_function13_group6 final : public fallible_driver
+{
+public:
+  fallible_function13_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(13);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(13);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function13_group6 instance13_group6(
+  driver14_group6);
+fallible_driver& driver13_group6 = instance13_group6;
+
+extern fallible_driver& driver15_group6;
+
+class fallible_function14_group6 final : public fallible_driver
+{
+public:
+  fallible_function14_group6(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(14);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(14);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect6 = side_effect6 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function14_group6 instance14_group6(
+  driver15_group6);
+fallible_driver& driver14_group6 = instance14_group6;
+
+class fallible_function15_group6 final : public fallible_driver
+{
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    if (auto result = non_trivial_destructor::initialize(15); result) {
+      auto result_internal = result.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect6 + 1;
+  }
+};
+
+static fallible_function15_group6 instance15_group6;
+fallible_driver& driver15_group6 = instance15_group6;
+
+extern fallible_driver& driver1_group7;
+
+class fallible_function0_group7 final : public fallible_driver
+{
+public:
+  fallible_function0_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(0);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(0);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function0_group7 instance0_group7(
+  driver1_group7);
+fallible_driver& driver0_group7 = instance0_group7;
+
+extern fallible_driver& driver2_group7;
+
+class fallible_function1_group7 final : public fallible_driver
+{
+public:
+  fallible_function1_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(1);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(1);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function1_group7 instance1_group7(
+  driver2_group7);
+fallible_driver& driver1_group7 = instance1_group7;
+
+extern fallible_driver& driver3_group7;
+
+class fallible_function2_group7 final : public fallible_driver
+{
+public:
+  fallible_function2_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(2);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(2);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function2_group7 instance2_group7(
+  driver3_group7);
+fallible_driver& driver2_group7 = instance2_group7;
+
+extern fallible_driver& driver4_group7;
+
+class fallible_function3_group7 final : public fallible_driver
+{
+public:
+  fallible_function3_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(3);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(3);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function3_group7 instance3_group7(
+  driver4_group7);
+fallible_driver& driver3_group7 = instance3_group7;
+
+extern fallible_driver& driver5_group7;
+
+class fallible_function4_group7 final : public fallible_driver
+{
+public:
+  fallible_function4_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(4);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(4);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function4_group7 instance4_group7(
+  driver5_group7);
+fallible_driver& driver4_group7 = instance4_group7;
+
+extern fallible_driver& driver6_group7;
+
+class fallible_function5_group7 final : public fallible_driver
+{
+public:
+  fallible_function5_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(5);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(5);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function5_group7 instance5_group7(
+  driver6_group7);
+fallible_driver& driver5_group7 = instance5_group7;
+
+extern fallible_driver& driver7_group7;
+
+class fallible_function6_group7 final : public fallible_driver
+{
+public:
+  fallible_function6_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(6);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(6);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function6_group7 instance6_group7(
+  driver7_group7);
+fallible_driver& driver6_group7 = instance6_group7;
+
+extern fallible_driver& driver8_group7;
+
+class fallible_function7_group7 final : public fallible_driver
+{
+public:
+  fallible_function7_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(7);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(7);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function7_group7 instance7_group7(
+  driver8_group7);
+fallible_driver& driver7_group7 = instance7_group7;
+
+extern fallible_driver& driver9_group7;
+
+class fallible_function8_group7 final : public fallible_driver
+{
+public:
+  fallible_function8_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(8);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(8);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function8_group7 instance8_group7(
+  driver9_group7);
+fallible_driver& driver8_group7 = instance8_group7;
+
+extern fallible_driver& driver10_group7;
+
+class fallible_function9_group7 final : public fallible_driver
+{
+public:
+  fallible_function9_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(9);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(9);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function9_group7 instance9_group7(
+  driver10_group7);
+fallible_driver& driver9_group7 = instance9_group7;
+
+extern fallible_driver& driver11_group7;
+
+class fallible_function10_group7 final : public fallible_driver
+{
+public:
+  fallible_function10_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(10);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(10);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function10_group7 instance10_group7(
+  driver11_group7);
+fallible_driver& driver10_group7 = instance10_group7;
+
+extern fallible_driver& driver12_group7;
+
+class fallible_function11_group7 final : public fallible_driver
+{
+public:
+  fallible_function11_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(11);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(11);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function11_group7 instance11_group7(
+  driver12_group7);
+fallible_driver& driver11_group7 = instance11_group7;
+
+extern fallible_driver& driver13_group7;
+
+class fallible_function12_group7 final : public fallible_driver
+{
+public:
+  fallible_function12_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(12);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(12);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function12_group7 instance12_group7(
+  driver13_group7);
+fallible_driver& driver12_group7 = instance12_group7;
+
+extern fallible_driver& driver14_group7;
+
+class fallible_function13_group7 final : public fallible_driver
+{
+public:
+  fallible_function13_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(13);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(13);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function13_group7 instance13_group7(
+  driver14_group7);
+fallible_driver& driver13_group7 = instance13_group7;
+
+extern fallible_driver& driver15_group7;
+
+class fallible_function14_group7 final : public fallible_driver
+{
+public:
+  fallible_function14_group7(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(14);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(14);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect7 = side_effect7 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function14_group7 instance14_group7(
+  driver15_group7);
+fallible_driver& driver14_group7 = instance14_group7;
+
+class fallible_function15_group7 final : public fallible_driver
+{
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    if (auto result = non_trivial_destructor::initialize(15); result) {
+      auto result_internal = result.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect7 + 1;
+  }
+};
+
+static fallible_function15_group7 instance15_group7;
+fallible_driver& driver15_group7 = instance15_group7;
+
+extern fallible_driver& driver1_group8;
+
+class fallible_function0_group8 final : public fallible_driver
+{
+public:
+  fallible_function0_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(0);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(0);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function0_group8 instance0_group8(
+  driver1_group8);
+fallible_driver& driver0_group8 = instance0_group8;
+
+extern fallible_driver& driver2_group8;
+
+class fallible_function1_group8 final : public fallible_driver
+{
+public:
+  fallible_function1_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(1);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(1);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function1_group8 instance1_group8(
+  driver2_group8);
+fallible_driver& driver1_group8 = instance1_group8;
+
+extern fallible_driver& driver3_group8;
+
+class fallible_function2_group8 final : public fallible_driver
+{
+public:
+  fallible_function2_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(2);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(2);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function2_group8 instance2_group8(
+  driver3_group8);
+fallible_driver& driver2_group8 = instance2_group8;
+
+extern fallible_driver& driver4_group8;
+
+class fallible_function3_group8 final : public fallible_driver
+{
+public:
+  fallible_function3_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(3);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(3);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function3_group8 instance3_group8(
+  driver4_group8);
+fallible_driver& driver3_group8 = instance3_group8;
+
+extern fallible_driver& driver5_group8;
+
+class fallible_function4_group8 final : public fallible_driver
+{
+public:
+  fallible_function4_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(4);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(4);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function4_group8 instance4_group8(
+  driver5_group8);
+fallible_driver& driver4_group8 = instance4_group8;
+
+extern fallible_driver& driver6_group8;
+
+class fallible_function5_group8 final : public fallible_driver
+{
+public:
+  fallible_function5_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(5);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(5);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function5_group8 instance5_group8(
+  driver6_group8);
+fallible_driver& driver5_group8 = instance5_group8;
+
+extern fallible_driver& driver7_group8;
+
+class fallible_function6_group8 final : public fallible_driver
+{
+public:
+  fallible_function6_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(6);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(6);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function6_group8 instance6_group8(
+  driver7_group8);
+fallible_driver& driver6_group8 = instance6_group8;
+
+extern fallible_driver& driver8_group8;
+
+class fallible_function7_group8 final : public fallible_driver
+{
+public:
+  fallible_function7_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(7);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(7);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function7_group8 instance7_group8(
+  driver8_group8);
+fallible_driver& driver7_group8 = instance7_group8;
+
+extern fallible_driver& driver9_group8;
+
+class fallible_function8_group8 final : public fallible_driver
+{
+public:
+  fallible_function8_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(8);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(8);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function8_group8 instance8_group8(
+  driver9_group8);
+fallible_driver& driver8_group8 = instance8_group8;
+
+extern fallible_driver& driver10_group8;
+
+class fallible_function9_group8 final : public fallible_driver
+{
+public:
+  fallible_function9_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(9);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(9);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function9_group8 instance9_group8(
+  driver10_group8);
+fallible_driver& driver9_group8 = instance9_group8;
+
+extern fallible_driver& driver11_group8;
+
+class fallible_function10_group8 final : public fallible_driver
+{
+public:
+  fallible_function10_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(10);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(10);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function10_group8 instance10_group8(
+  driver11_group8);
+fallible_driver& driver10_group8 = instance10_group8;
+
+extern fallible_driver& driver12_group8;
+
+class fallible_function11_group8 final : public fallible_driver
+{
+public:
+  fallible_function11_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(11);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(11);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function11_group8 instance11_group8(
+  driver12_group8);
+fallible_driver& driver11_group8 = instance11_group8;
+
+extern fallible_driver& driver13_group8;
+
+class fallible_function12_group8 final : public fallible_driver
+{
+public:
+  fallible_function12_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(12);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(12);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function12_group8 instance12_group8(
+  driver13_group8);
+fallible_driver& driver12_group8 = instance12_group8;
+
+extern fallible_driver& driver14_group8;
+
+class fallible_function13_group8 final : public fallible_driver
+{
+public:
+  fallible_function13_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(13);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(13);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function13_group8 instance13_group8(
+  driver14_group8);
+fallible_driver& driver13_group8 = instance13_group8;
+
+extern fallible_driver& driver15_group8;
+
+class fallible_function14_group8 final : public fallible_driver
+{
+public:
+  fallible_function14_group8(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(14);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(14);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect8 = side_effect8 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function14_group8 instance14_group8(
+  driver15_group8);
+fallible_driver& driver14_group8 = instance14_group8;
+
+class fallible_function15_group8 final : public fallible_driver
+{
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    if (auto result = non_trivial_destructor::initialize(15); result) {
+      auto result_internal = result.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect8 + 1;
+  }
+};
+
+static fallible_function15_group8 instance15_group8;
+fallible_driver& driver15_group8 = instance15_group8;
+
+extern fallible_driver& driver1_group9;
+
+class fallible_function0_group9 final : public fallible_driver
+{
+public:
+  fallible_function0_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(0);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(0);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function0_group9 instance0_group9(
+  driver1_group9);
+fallible_driver& driver0_group9 = instance0_group9;
+
+extern fallible_driver& driver2_group9;
+
+class fallible_function1_group9 final : public fallible_driver
+{
+public:
+  fallible_function1_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(1);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(1);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function1_group9 instance1_group9(
+  driver2_group9);
+fallible_driver& driver1_group9 = instance1_group9;
+
+extern fallible_driver& driver3_group9;
+
+class fallible_function2_group9 final : public fallible_driver
+{
+public:
+  fallible_function2_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(2);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(2);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function2_group9 instance2_group9(
+  driver3_group9);
+fallible_driver& driver2_group9 = instance2_group9;
+
+extern fallible_driver& driver4_group9;
+
+class fallible_function3_group9 final : public fallible_driver
+{
+public:
+  fallible_function3_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(3);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(3);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function3_group9 instance3_group9(
+  driver4_group9);
+fallible_driver& driver3_group9 = instance3_group9;
+
+extern fallible_driver& driver5_group9;
+
+class fallible_function4_group9 final : public fallible_driver
+{
+public:
+  fallible_function4_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(4);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(4);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function4_group9 instance4_group9(
+  driver5_group9);
+fallible_driver& driver4_group9 = instance4_group9;
+
+extern fallible_driver& driver6_group9;
+
+class fallible_function5_group9 final : public fallible_driver
+{
+public:
+  fallible_function5_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(5);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(5);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function5_group9 instance5_group9(
+  driver6_group9);
+fallible_driver& driver5_group9 = instance5_group9;
+
+extern fallible_driver& driver7_group9;
+
+class fallible_function6_group9 final : public fallible_driver
+{
+public:
+  fallible_function6_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(6);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(6);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function6_group9 instance6_group9(
+  driver7_group9);
+fallible_driver& driver6_group9 = instance6_group9;
+
+extern fallible_driver& driver8_group9;
+
+class fallible_function7_group9 final : public fallible_driver
+{
+public:
+  fallible_function7_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(7);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(7);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function7_group9 instance7_group9(
+  driver8_group9);
+fallible_driver& driver7_group9 = instance7_group9;
+
+extern fallible_driver& driver9_group9;
+
+class fallible_function8_group9 final : public fallible_driver
+{
+public:
+  fallible_function8_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(8);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(8);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function8_group9 instance8_group9(
+  driver9_group9);
+fallible_driver& driver8_group9 = instance8_group9;
+
+extern fallible_driver& driver10_group9;
+
+class fallible_function9_group9 final : public fallible_driver
+{
+public:
+  fallible_function9_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(9);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(9);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function9_group9 instance9_group9(
+  driver10_group9);
+fallible_driver& driver9_group9 = instance9_group9;
+
+extern fallible_driver& driver11_group9;
+
+class fallible_function10_group9 final : public fallible_driver
+{
+public:
+  fallible_function10_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(10);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(10);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function10_group9 instance10_group9(
+  driver11_group9);
+fallible_driver& driver10_group9 = instance10_group9;
+
+extern fallible_driver& driver12_group9;
+
+class fallible_function11_group9 final : public fallible_driver
+{
+public:
+  fallible_function11_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(11);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(11);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function11_group9 instance11_group9(
+  driver12_group9);
+fallible_driver& driver11_group9 = instance11_group9;
+
+extern fallible_driver& driver13_group9;
+
+class fallible_function12_group9 final : public fallible_driver
+{
+public:
+  fallible_function12_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(12);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(12);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function12_group9 instance12_group9(
+  driver13_group9);
+fallible_driver& driver12_group9 = instance12_group9;
+
+extern fallible_driver& driver14_group9;
+
+class fallible_function13_group9 final : public fallible_driver
+{
+public:
+  fallible_function13_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(13);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(13);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function13_group9 instance13_group9(
+  driver14_group9);
+fallible_driver& driver13_group9 = instance13_group9;
+
+extern fallible_driver& driver15_group9;
+
+class fallible_function14_group9 final : public fallible_driver
+{
+public:
+  fallible_function14_group9(fallible_driver& p_next)
+    : m_next(&p_next)
+  {
+  }
+
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    auto result_a = non_trivial_destructor::initialize(14);
+
+    if (result_a) {
+      auto result_internal = result_a.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_a.error());
+    }
+
+    auto result_b = non_trivial_destructor::initialize(14);
+
+    if (result_b) {
+      auto result_internal = result_b.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result_b.error());
+    }
+
+    if (auto result = m_next->call(); result) {
+      side_effect9 = side_effect9 + result.value();
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9;
+  }
+
+  fallible_driver* m_next;
+};
+
+static fallible_function14_group9 instance14_group9(
+  driver15_group9);
+fallible_driver& driver14_group9 = instance14_group9;
+
+class fallible_function15_group9 final : public fallible_driver
+{
+private:
+  tl::expected<int, error_t> driver_call() override
+  {
+    if (auto result = non_trivial_destructor::initialize(15); result) {
+      auto result_internal = result.value().trigger();
+      if (!result_internal) {
+        return tl::unexpected(result_internal.error());
+      }
+    } else {
+      return tl::unexpected(result.error());
+    }
+
+    return side_effect9 + 1;
+  }
+};
+
+static fallible_function15_group9 instance15_group9;
+fallible_driver& driver15_group9 = instance15_group9;
+
@@ -0,0 +1,54 @@
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Split a generated program into several translation units.
+
+The generators write the license, the shared declarations and the program as
+one header. With --translation_units N the declarations move into
+common.hpp, which every unit includes after the license.
+"""
+
+import pathlib
+import re
+
+# Where the license ends, every generated header has the same one
+LICENSE_END = "// limitations under the License.\n"
+
+
+def split_header(header: str, program_start) -> tuple:
+    """License, shared declarations and program parts of the file header
+
+    program_start is the first line after the shared declarations, either as
+    text or as a compiled pattern.
+    """
+    license_end = header.index(LICENSE_END) + len(LICENSE_END)
+    if isinstance(program_start, str):
+        start = header.index(program_start)
+    else:
+        start = program_start.search(header).start()
+    return (header[:license_end], header[license_end:start], header[start:])
+
+
+def shareable(declarations: str) -> str:
+    """Makes variable definitions safe to include in every unit"""
+    return re.sub(r"^HARNESS_STATE ", "inline HARNESS_STATE ", declarations,
+                  flags=re.MULTILINE)
+
+
+def write_units(directory: str, units: list):
+    """Writes (file name, text) pairs into directory"""
+    path = pathlib.Path(directory)
+    path.mkdir(parents=True, exist_ok=True)
+    for name, text in units:
+        (path / name).write_text(text + "\n")
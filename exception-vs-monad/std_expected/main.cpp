@@ -0,0 +1,136 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <expected>
+
+#if defined(HOST_BENCHMARK)
+#include <harness.hpp>
+#endif
+
+// Switches
+constexpr size_t error_size = 4;
+#if defined(HOST_BENCHMARK)
+// The host driver needs a reachable error path to time
+constexpr bool error_in_constructor = true;
+#else
+constexpr bool error_in_constructor = false;
+#endif
+constexpr bool error_in_class_function = false;
+#if defined(HOST_BENCHMARK)
+using harness::depth_before_exception;
+#else
+constexpr bool depth_before_exception = 50;
+#endif
+
+struct error_t
+{
+  std::array<std::uint8_t, error_size> data;
+};
+
+volatile std::uint64_t enable_register;
+volatile std::uint64_t trigger_register;
+
+class non_trivial_destructor
+{
+public:
+  static std::expected<non_trivial_destructor, error_t> initialize(
+    uint8_t p_channel)
+  {
+    if constexpr (error_in_constructor) {
+      if (p_channel >= depth_before_exception) {
+        return std::unexpected(error_t{ .data = { 0x55, 0xAA, 0x33, 0x44 } });
+      }
+    }
+    enable_register =
+      enable_register | (std::uint64_t{ 1 } << (p_channel % 64));
+    return non_trivial_destructor{ p_channel };
+  }
+
+  non_trivial_destructor(non_trivial_destructor&) = delete;
+  non_trivial_destructor& operator=(non_trivial_destructor&) = delete;
+  non_trivial_destructor(non_trivial_destructor&&) = default;
+  non_trivial_destructor& operator=(non_trivial_destructor&&) = default;
+
+  std::expected<void, error_t> trigger()
+  {
+    if constexpr (error_in_class_function) {
+      if (m_channel >= depth_before_exception) {
+        return std::unexpected(error_t{ .data = { 0xAA, 0xBB, 0x33, 0x44 } });
+      }
+    }
+    trigger_register =
+      trigger_register | (std::uint64_t{ 1 } << (m_channel % 64));
+    return {};
+  }
+
+  ~non_trivial_destructor()
+  {
+    enable_register =
+      enable_register & ~(std::uint64_t{ 1 } << (m_channel % 64));
+  }
+
+private:
+  non_trivial_destructor(uint8_t p_channel)
+    : m_channel(p_channel)
+  {
+  }
+
+  uint8_t m_channel = 0;
+};
+
+std::expected<void, error_t> return_error();
+std::expected<void, error_t> top_call()
+{
+  auto result = return_error();
+  if (!result) {
+    return std::unexpected(result.error());
+  }
+  return {};
+}
+
+#if defined(HOST_BENCHMARK)
+const std::uint32_t harness::failing_threshold = 50;
+const harness::result_layout harness::layout =
+  harness::describe<error_t, decltype(top_call())>();
+int harness::call_top()
+#else
+int main()
+#endif
+{
+  auto result = top_call();
+  if (!result) {
+    return static_cast<int>(result.error().data[0]);
+  }
+  return 0;
+}
+
+std::expected<void, error_t> return_error()
+{
+  auto result = non_trivial_destructor::initialize(50);
+
+  if (result) {
+    auto result2 = result.value().trigger();
+    if (!result2) {
+      return std::unexpected(result2.error());
+    }
+  } else {
+    return std::unexpected(result.error());
+  }
+
+  return {};
+}
\ No newline at end of file
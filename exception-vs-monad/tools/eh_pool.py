@@ -0,0 +1,225 @@
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Measure the RAM of the exception emergency pool against what it buys.
+
+libstdc++ takes every thrown exception from malloc and falls back to its
+emergency pool when malloc fails. The variant is built once per pool setting
+and each row gives the image's .data and .bss, the heap static constructors
+took before main(), and with the host driver the error path latency, whether
+a throw still works once the heap is exhausted, and how long it then takes.
+
+    python3 tools/eh_pool.py --pools libstdc++,0,1,2,4 -o eh_pool.csv
+
+Pool settings, comma separated:
+
+    libstdc++    the runtime's own pool
+    libstdc++:N  the same, run with
+                 GLIBCXX_TUNABLES=glibcxx.eh_pool.obj_count=N. Only
+                 libstdc++ 13 and newer read it, startup_heap_bytes says
+                 whether the pool changed.
+    N            exception_pool.cpp with EXCEPTION_POOL_HEAP_FIRST as the pool,
+                 N slots of --object-size bytes in .bss. 0 is no pool at all.
+
+Host images built here link libstdc++ and libgcc statically, like newlib
+images do, unlike those of the host CMake build and tools/sweep.py. A shared
+libstdc++ allocates its pool at startup even when exception_pool.cpp
+replaces the functions that use it. `--target arm` only builds the variant's
+own main() and reports its sizes, nothing is run.
+"""
+
+import argparse
+import csv
+import json
+import os
+import pathlib
+import subprocess
+import sys
+
+import elf_sections
+import sweep
+import toolchain
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+
+VARIANTS = ["exception", "exception_depth"]
+
+TUNABLE = "glibcxx.eh_pool.obj_count"
+
+# exception_pool.cpp's arena, in its anonymous namespace
+ARENA_SYMBOL = "_ZN14exception_pool12_GLOBAL__N_15arenaE"
+
+# Static runtime libraries on the host, so that only what is used is linked
+STATIC_RUNTIME = ["-static-libstdc++", "-static-libgcc"]
+
+
+def parse_pools(text: str) -> list:
+    """"libstdc++,libstdc++:0,2" -> ["libstdc++", "libstdc++:0", "2"]"""
+    pools = text.split(",")
+    for pool in pools:
+        runtime, _, count = pool.partition(":")
+        valid = (count.isdigit() if runtime == "libstdc++" and count
+                 else pool == "libstdc++" or pool.isdigit())
+        if not valid:
+            raise argparse.ArgumentTypeError(
+                f"{pool} is not libstdc++, libstdc++:N or N")
+    return pools
+
+
+def pool_name(pool: str) -> str:
+    """Directory and suite name for a pool setting"""
+    if pool.isdigit():
+        return f"slots{pool}"
+    return pool.replace("libstdc++", "libstdcxx").replace(":", "_")
+
+
+def build(variant: str, pool: str, args) -> pathlib.Path:
+    target = sweep.TARGETS[args.target]
+    name = f"{variant}_{pool_name(pool)}"
+    directory = args.build_dir / args.target / name
+    directory.mkdir(parents=True, exist_ok=True)
+    image = directory / f"{name}.elf"
+
+    pool_flags = []
+    pool_sources = []
+    if pool.isdigit():
+        pool_flags = ["-DEXCEPTION_POOL", "-DEXCEPTION_POOL_HEAP_FIRST",
+                      f"-DEXCEPTION_POOL_SLOTS={pool}",
+                      f"-DEXCEPTION_POOL_OBJECT_SIZE={args.object_size}"]
+        pool_sources = [ROOT / "exception_pool" / "exception_pool.cpp"]
+    runs = target["runs"]
+    command = [args.cxx or target["cxx"], "-std=c++20",
+               f"-{args.optimization or target['optimization']}", "-g",
+               *target["flags"], *pool_flags,
+               f'-DHOST_BENCHMARK_VARIANT="{name}"',
+               f"-I{ROOT / 'host'}",
+               *(f"-I{include}" for include in args.include),
+               str(ROOT / variant / "main.cpp"),
+               *(str(source) for source in target["sources"]),
+               *(str(source) for source in pool_sources),
+               *target["libraries"], *(STATIC_RUNTIME if runs else []),
+               "-o", str(image)]
+    subprocess.run(command, check=True)
+    return image
+
+
+def pool_bytes(image: pathlib.Path) -> int:
+    """Size of exception_pool.cpp's arena, 0 when it has none"""
+    for symbol in elf_sections.read_symbol_table(image):
+        if symbol.name == ARENA_SYMBOL:
+            return symbol.size
+    return 0
+
+
+def run(image: pathlib.Path, pool: str, args) -> dict:
+    """Error path latency, then the throws with the heap exhausted"""
+    environment = dict(os.environ)
+    environment.pop("GLIBCXX_TUNABLES", None)
+    _, _, count = pool.partition(":")
+    if pool.startswith("libstdc++") and count:
+        environment["GLIBCXX_TUNABLES"] = f"{TUNABLE}={count}"
+    output = subprocess.run([str(image),
+                             "--error-iterations", str(args.error_iterations),
+                             "--trials", str(args.trials),
+                             "--failure-rates", "",
+                             "--cold-trials", "0",
+                             "--exhausted-calls", str(args.exhausted_calls),
+                             "--json", "-"],
+                            capture_output=True, text=True, check=True,
+                            env=environment)
+    results = {result["name"]: result
+               for result in json.loads(output.stdout)["results"]}
+    error = results["error"]
+    exhausted = results["error_exhausted"]
+    return {
+        "startup_heap_bytes": exhausted["startup_heap_bytes"],
+        "error_ns": error["median_ns"],
+        "error_p99_ns": error["p99_ns"],
+        "throws_without_heap": exhausted["throws_without_heap"],
+        # Nothing to time when the throws did not survive
+        "exhausted_error_ns": (exhausted["median_ns"]
+                               if exhausted["throws_without_heap"] else ""),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--variants", nargs="+", default=["exception"],
+                        choices=VARIANTS)
+    parser.add_argument("-p", "--pools", default="libstdc++,0,1,2,4",
+                        type=parse_pools)
+    parser.add_argument("--object-size", default=256, type=int,
+                        help="Largest thrown object a slot holds, in bytes")
+    parser.add_argument("--target", default="host",
+                        choices=list(sweep.TARGETS))
+    parser.add_argument("--cxx", help="Compiler, defaults to the target's")
+    parser.add_argument("-O", "--optimization",
+                        help="Optimization level, e.g. Os, defaults to the "
+                        "target's")
+    parser.add_argument("-I", "--include", action="append", default=[],
+                        help="Extra include directory")
+    parser.add_argument("--error-iterations", default=1_000, type=int,
+                        help="Error path calls per trial")
+    parser.add_argument("--trials", default=20, type=int)
+    parser.add_argument("--exhausted-calls", default=100, type=int,
+                        help="Error path calls with the heap exhausted")
+    parser.add_argument("--build-dir", default=ROOT / "build" / "eh_pool",
+                        type=pathlib.Path)
+    parser.add_argument("-o", "--output", default="eh_pool.csv")
+    args = parser.parse_args()
+
+    target = sweep.TARGETS[args.target]
+    compiler = toolchain.compiler_version(args.cxx or target["cxx"])
+    fields = ["variant", "target", "compiler", "optimization", "pool",
+              "pool_bytes", ".data", ".bss"]
+    if target["runs"]:
+        fields += ["startup_heap_bytes", "ram_bytes", "error_ns",
+                   "error_p99_ns", "throws_without_heap",
+                   "exhausted_error_ns"]
+    with open(args.output, "w", newline="") as output:
+        writer = csv.DictWriter(output, fieldnames=fields)
+        writer.writeheader()
+        for variant in args.variants:
+            for pool in args.pools:
+                image = build(variant, pool, args)
+                sizes = elf_sections.section_sizes(image)
+                row = {
+                    "variant": variant,
+                    "target": args.target,
+                    "compiler": compiler,
+                    "optimization": (args.optimization
+                                     or target["optimization"]),
+                    "pool": pool,
+                    # What exception_pool.cpp sets aside. libstdc++'s own
+                    # pool shows up in startup_heap_bytes instead.
+                    "pool_bytes": pool_bytes(image) if pool.isdigit() else "",
+                    ".data": sizes.get(".data", 0),
+                    ".bss": sizes.get(".bss", 0),
+                }
+                if target["runs"]:
+                    row.update(run(image, pool, args))
+                    row["ram_bytes"] = (row[".data"] + row[".bss"]
+                                        + row["startup_heap_bytes"])
+                writer.writerow(row)
+                print(f"{variant} pool={pool}: .data={row['.data']} "
+                      f".bss={row['.bss']}"
+                      + (f" heap={row['startup_heap_bytes']} "
+                         f"throws_without_heap="
+                         f"{row['throws_without_heap']}"
+                         if target["runs"] else ""),
+                      file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
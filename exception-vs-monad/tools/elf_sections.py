@@ -0,0 +1,149 @@
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Read section sizes and symbols straight out of an ELF file.
+
+Only the section header table and the symbol table are parsed, so this works
+the same for the host and the ARM images without needing binutils for the
+target.
+"""
+
+import struct
+
+_ELF_MAGIC = b"\x7fELF"
+_ELFCLASS64 = 2
+_ELFDATA2MSB = 2
+_SHT_SYMTAB = 2
+_SHT_NOBITS = 8
+_STT_FUNC = 2
+
+
+class Section:
+    def __init__(self, name: str, kind: int, address: int, offset: int,
+                 size: int, link: int = 0, entry_size: int = 0):
+        self.name = name
+        self.kind = kind
+        self.address = address
+        self.offset = offset
+        self.size = size
+        self.link = link
+        self.entry_size = entry_size
+
+    @property
+    def occupies_file(self) -> bool:
+        return self.kind != _SHT_NOBITS
+
+
+class Symbol:
+    def __init__(self, name: str, value: int, size: int, kind: int,
+                 section: int):
+        self.name = name
+        self.value = value
+        self.size = size
+        self.kind = kind
+        self.section = section
+
+    @property
+    def is_function(self) -> bool:
+        return self.kind == _STT_FUNC
+
+
+def read_image(path: str) -> tuple:
+    """The whole file, whether it is 64 bit, and its struct byte order"""
+    with open(path, "rb") as file:
+        image = file.read()
+
+    if image[:4] != _ELF_MAGIC:
+        raise ValueError(f"{path} is not an ELF file")
+
+    is_64bit = image[4] == _ELFCLASS64
+    endian = ">" if image[5] == _ELFDATA2MSB else "<"
+    return image, is_64bit, endian
+
+
+def read_sections(path: str) -> list:
+    image, is_64bit, endian = read_image(path)
+
+    if is_64bit:
+        header_format = endian + "QQQIHHHHHH"
+        section_format = endian + "IIQQQQIIQQ"
+    else:
+        header_format = endian + "IIIIHHHHHH"
+        section_format = endian + "IIIIIIIIII"
+
+    # e_entry is the first field after the 24 byte identification block
+    (_, _, section_table, _, _, _, _, entry_size, entry_count,
+     names_index) = struct.unpack_from(header_format, image, 0x18)
+
+    raw = [struct.unpack_from(section_format, image,
+                              section_table + index * entry_size)
+           for index in range(entry_count)]
+
+    names_offset = raw[names_index][4]
+
+    def name_at(offset: int) -> str:
+        start = names_offset + offset
+        return image[start:image.index(b"\0", start)].decode()
+
+    return [Section(name=name_at(entry[0]), kind=entry[1], address=entry[3],
+                    offset=entry[4], size=entry[5], link=entry[6],
+                    entry_size=entry[9])
+            for entry in raw]
+
+
+def section_sizes(path: str) -> dict:
+    """Map of section name to size in bytes, summed over same named sections"""
+    sizes = {}
+    for section in read_sections(path):
+        if section.name:
+            sizes[section.name] = sizes.get(section.name, 0) + section.size
+    return sizes
+
+
+def read_symbols(path: str) -> dict:
+    """Map of symbol name to address, from the static symbol table
+
+    Thumb function addresses have bit 0 set, as in the symbol table.
+    """
+    return {symbol.name: symbol.value for symbol in read_symbol_table(path)}
+
+
+def read_symbol_table(path: str) -> list:
+    """Every named symbol in the static symbol table"""
+    image, is_64bit, endian = read_image(path)
+    sections = read_sections(path)
+    if is_64bit:
+        symbol_format = endian + "IBBHQQ"
+    else:
+        symbol_format = endian + "IIIBBH"
+
+    symbols = []
+    for table in sections:
+        if table.kind != _SHT_SYMTAB:
+            continue
+        names = sections[table.link]
+        for offset in range(table.offset, table.offset + table.size,
+                            table.entry_size):
+            if is_64bit:
+                (name_offset, info, _, section, value,
+                 size) = struct.unpack_from(symbol_format, image, offset)
+            else:
+                (name_offset, value, size, info, _,
+                 section) = struct.unpack_from(symbol_format, image, offset)
+            start = names.offset + name_offset
+            name = image[start:image.index(b"\0", start)].decode()
+            if name:
+                symbols.append(Symbol(name=name, value=value, size=size,
+                                      kind=info & 0xf, section=section))
+    return symbols
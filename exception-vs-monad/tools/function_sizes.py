@@ -0,0 +1,358 @@
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Attribute code and unwind table bytes to each generated function.
+
+Reads a linked image and charges every function with:
+
+  .text              its symbol size, if its symbol is in .text
+  .ARM.exidx         its index table entries (8 bytes each)
+  .ARM.extab         the unwind data and LSDA its index entries point at
+  .eh_frame          its FDEs
+  .gcc_except_table  the LSDA its FDEs point at
+
+An .ARM.extab or .gcc_except_table entry is sized as the distance to the
+next entry that something points at, so padding goes to the entry before it.
+Functions whose symbol matches --pattern are listed one per row. Everything
+else is summed into one row per section. The marginal cost of one more
+fallible frame is the "per function" row.
+
+    python3 tools/function_sizes.py build/sweep/arm/.../exception_depth.elf
+"""
+
+import argparse
+import bisect
+import csv
+import re
+import struct
+import sys
+
+import elf_sections
+
+SECTIONS = [".text", ".ARM.exidx", ".ARM.extab", ".eh_frame",
+            ".gcc_except_table"]
+
+# The generated frames, fallible_functionN_groupM
+FRAME_PATTERN = r"fallible_function\d+_group\d+"
+
+# DWARF pointer encodings used by .eh_frame
+_DW_EH_PE_omit = 0xff
+_DW_EH_PE_pcrel = 0x10
+_FIXED_FORMATS = {0x00: None, 0x02: "H", 0x03: "I", 0x04: "Q",
+                  0x0a: "h", 0x0b: "i", 0x0c: "q"}
+
+_EXIDX_CANTUNWIND = 1
+
+
+class Image:
+    def __init__(self, path: str):
+        self.data, self.is_64bit, self.endian = elf_sections.read_image(path)
+        # In section header order, so symbols can look theirs up by index
+        self.section_list = elf_sections.read_sections(path)
+        self.sections = {section.name: section
+                         for section in self.section_list if section.name}
+        functions = sorted((symbol for symbol in
+                            elf_sections.read_symbol_table(path)
+                            if symbol.is_function and symbol.size > 0),
+                           key=lambda symbol: (symbol.value, symbol.name))
+        # Aliases, such as a class's complete and base object constructors,
+        # share one body and are only counted once
+        self.functions = [symbol for index, symbol in enumerate(functions)
+                          if index == 0
+                          or symbol.value != functions[index - 1].value]
+        # Thumb functions have bit 0 set in the symbol table
+        self.starts = [symbol.value & ~1 for symbol in self.functions]
+
+    def function_at(self, address: int):
+        index = bisect.bisect_right(self.starts, address) - 1
+        if index >= 0:
+            symbol = self.functions[index]
+            if address < self.starts[index] + symbol.size:
+                return symbol.name
+        return None
+
+    def section_name(self, symbol) -> str:
+        """Name of the section a symbol is defined in, None for special ones"""
+        if 0 < symbol.section < len(self.section_list):
+            return self.section_list[symbol.section].name
+        return None
+
+    def word(self, offset: int) -> int:
+        return struct.unpack_from(self.endian + "I", self.data, offset)[0]
+
+    def offset_of(self, section, address: int) -> int:
+        return section.offset + address - section.address
+
+
+def prel31(word: int, address: int) -> int:
+    """Target of an ARM EHABI 31 bit place relative offset"""
+    offset = word & 0x7fffffff
+    if offset & 0x40000000:
+        offset -= 0x80000000
+    return (address + offset) & 0xffffffff
+
+
+def sized_by_next(starts: dict, section) -> dict:
+    """Sizes entries at the given start addresses by the gap to the next one
+
+    starts maps an address to the function that points at it.
+    """
+    charges = {}
+    ordered = sorted(starts)
+    ends = ordered[1:] + [section.address + section.size]
+    for start, end in zip(ordered, ends):
+        function = starts[start]
+        charges[function] = charges.get(function, 0) + end - start
+    return charges
+
+
+def arm_tables(image: Image) -> tuple:
+    """Bytes of .ARM.exidx and .ARM.extab charged to each function"""
+    exidx = image.sections.get(".ARM.exidx")
+    extab = image.sections.get(".ARM.extab")
+    index_charges = {}
+    table_starts = {}
+    if exidx is None:
+        return index_charges, {}
+
+    for address in range(exidx.address, exidx.address + exidx.size, 8):
+        offset = image.offset_of(exidx, address)
+        function = image.function_at(prel31(image.word(offset), address))
+        index_charges[function] = index_charges.get(function, 0) + 8
+        data = image.word(offset + 4)
+        # Out of line entries point into .ARM.extab, the rest are inline
+        if data != _EXIDX_CANTUNWIND and not data & 0x80000000:
+            table_starts[prel31(data, address + 4)] = function
+
+    table_charges = sized_by_next(table_starts, extab) if extab else {}
+    return index_charges, table_charges
+
+
+def read_uleb128(data: bytes, offset: int) -> tuple:
+    value = 0
+    shift = 0
+    while True:
+        byte = data[offset]
+        offset += 1
+        value |= (byte & 0x7f) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, offset
+
+
+def read_encoded(image: Image, encoding: int, offset: int,
+                 address: int) -> tuple:
+    """Reads a DWARF encoded pointer at offset, which is at address"""
+    if encoding == _DW_EH_PE_omit:
+        return None, offset
+    kind = encoding & 0x0f
+    if kind == 0x01:
+        value, end = read_uleb128(image.data, offset)
+    else:
+        format = _FIXED_FORMATS[kind] or ("Q" if image.is_64bit else "I")
+        value = struct.unpack_from(image.endian + format, image.data,
+                                   offset)[0]
+        end = offset + struct.calcsize(format)
+    if encoding & 0x70 == _DW_EH_PE_pcrel:
+        value += address
+    mask = (1 << 64) - 1 if image.is_64bit else 0xffffffff
+    return value & mask, end
+
+
+def parse_cie(image: Image, offset: int) -> dict:
+    """FDE and LSDA pointer encodings from a CIE's augmentation"""
+    data = image.data
+    version = data[offset + 8]  # after the length and the CIE id
+    augmentation_start = offset + 9
+    augmentation = data[augmentation_start:data.index(b"\0",
+                                                      augmentation_start)]
+    cursor = augmentation_start + len(augmentation) + 1
+    # Code and data alignment. The latter is signed, but skipping a LEB128
+    # does not depend on that.
+    _, cursor = read_uleb128(data, cursor)
+    _, cursor = read_uleb128(data, cursor)
+    # Return address register, a byte in version 1 and a LEB128 after that
+    if version == 1:
+        cursor += 1
+    else:
+        _, cursor = read_uleb128(data, cursor)
+    encodings = {"fde": 0x00, "lsda": _DW_EH_PE_omit}
+    if not augmentation.startswith(b"z"):
+        return encodings
+    _, cursor = read_uleb128(data, cursor)  # augmentation length
+    for letter in augmentation[1:].decode():
+        if letter == "R":
+            encodings["fde"] = data[cursor]
+            cursor += 1
+        elif letter == "L":
+            encodings["lsda"] = data[cursor]
+            cursor += 1
+        elif letter == "P":
+            personality = data[cursor]
+            _, cursor = read_encoded(image, personality & 0x7f, cursor + 1, 0)
+    return encodings
+
+
+def eh_frame_tables(image: Image) -> tuple:
+    """Bytes of .eh_frame and .gcc_except_table charged to each function"""
+    eh_frame = image.sections.get(".eh_frame")
+    except_table = image.sections.get(".gcc_except_table")
+    frame_charges = {}
+    table_starts = {}
+    if eh_frame is None:
+        return frame_charges, {}
+
+    cies = {}
+    offset = eh_frame.offset
+    end = eh_frame.offset + eh_frame.size
+    while offset < end:
+        length = image.word(offset)
+        if length == 0:
+            break
+        header = 4
+        if length == 0xffffffff:
+            length = struct.unpack_from(image.endian + "Q", image.data,
+                                        offset + 4)[0]
+            header = 12
+        record_end = offset + header + length
+        id_offset = offset + header
+        cie_pointer = image.word(id_offset)
+        if cie_pointer == 0:
+            cies[offset] = parse_cie(image, offset)
+        else:
+            cie_offset = id_offset - cie_pointer
+            encodings = cies.setdefault(cie_offset,
+                                        parse_cie(image, cie_offset))
+            cursor = id_offset + 4
+            address = eh_frame.address + cursor - eh_frame.offset
+            start, cursor = read_encoded(image, encodings["fde"], cursor,
+                                         address)
+            function = image.function_at(start)
+            frame_charges[function] = (frame_charges.get(function, 0) +
+                                       record_end - offset)
+            # pc_range uses the same format without the pc relative part
+            _, cursor = read_encoded(image, encodings["fde"] & 0x0f, cursor,
+                                     0)
+            _, cursor = read_uleb128(image.data, cursor)
+            if encodings["lsda"] != _DW_EH_PE_omit:
+                address = eh_frame.address + cursor - eh_frame.offset
+                lsda, _ = read_encoded(image, encodings["lsda"], cursor,
+                                       address)
+                if lsda:
+                    table_starts[lsda] = function
+        offset = record_end
+
+    table_charges = ({} if except_table is None else
+                     sized_by_next(table_starts, except_table))
+    return frame_charges, table_charges
+
+
+def attribute(path: str) -> dict:
+    """Map of function name to {section: bytes}, None is unattributed"""
+    image = Image(path)
+    charges = {}
+
+    def charge(section: str, per_function: dict):
+        for function, size in per_function.items():
+            charges.setdefault(function, {})[section] = (
+                charges.get(function, {}).get(section, 0) + size)
+
+    # Functions outside the sections listed, such as .init or .plt on the
+    # host, are neither charged nor part of any section's remainder
+    for symbol in image.functions:
+        section = image.section_name(symbol)
+        if section in SECTIONS:
+            charge(section, {symbol.name: symbol.size})
+    index, table = arm_tables(image)
+    charge(".ARM.exidx", index)
+    charge(".ARM.extab", table)
+    frames, except_table = eh_frame_tables(image)
+    charge(".eh_frame", frames)
+    charge(".gcc_except_table", except_table)
+
+    # Whatever a section holds beyond the charged bytes is unattributed
+    for section in SECTIONS:
+        if section in image.sections:
+            charged = sum(sizes.get(section, 0)
+                          for function, sizes in charges.items()
+                          if function is not None)
+            charges.setdefault(None, {})[section] = (
+                image.sections[section].size - charged)
+    return charges
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("image", help="Linked ELF file")
+    parser.add_argument("--pattern", default=FRAME_PATTERN,
+                        help="Regex for the functions to list one by one")
+    parser.add_argument("--csv", help="Also write the table to this file")
+    args = parser.parse_args()
+
+    pattern = re.compile(args.pattern)
+    rows = {}
+    rest = {section: 0 for section in SECTIONS}
+    for function, sizes in attribute(args.image).items():
+        match = pattern.search(function) if function else None
+        if match:
+            # Mangled names and split .cold parts fold into one row
+            row = rows.setdefault(match.group(0),
+                                  {section: 0 for section in SECTIONS})
+        else:
+            row = rest
+        for section, size in sizes.items():
+            row[section] += size
+
+    def natural(name: str) -> list:
+        return [int(part) if part.isdigit() else part
+                for part in re.split(r"(\d+)", name)]
+
+    table = [(name, rows[name]) for name in sorted(rows, key=natural)]
+    matched = {section: sum(row[section] for row in rows.values())
+               for section in SECTIONS}
+    count = max(len(rows), 1)
+    per_function = {section: matched[section] / count
+                    for section in SECTIONS}
+    total = {section: matched[section] + rest[section]
+             for section in SECTIONS}
+    table += [(f"matched ({len(rows)})", matched),
+              ("per function", per_function),
+              ("everything else", rest),
+              ("total", total)]
+
+    def cell(value, width: int) -> str:
+        if isinstance(value, float):
+            return f"{value:>{width}.1f}"
+        return f"{value:>{width}}"
+
+    width = max(len(name) for name, _ in table)
+    header = f"{'function':<{width}}" + "".join(
+        f"{section:>19}" for section in SECTIONS) + f"{'all':>10}"
+    print(header)
+    for name, sizes in table:
+        cells = "".join(cell(sizes[section], 19) for section in SECTIONS)
+        print(f"{name:<{width}}{cells}{cell(sum(sizes.values()), 10)}")
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as output:
+            writer = csv.writer(output)
+            writer.writerow(["function", *SECTIONS])
+            for name, sizes in table:
+                writer.writerow([name, *(sizes[section]
+                                         for section in SECTIONS)])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
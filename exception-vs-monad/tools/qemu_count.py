@@ -0,0 +1,253 @@
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Count the instructions each variant runs on a Cortex-M4 under QEMU.
+
+Every variant's main.cpp is built with qemu/driver.cpp for QEMU's mps2-an386
+machine. The image is then run under qemu-system-arm with one instruction per
+translation block and exec logging on, so the log has one line per executed
+instruction. The driver calls qemu_marker_start() and qemu_marker_stop()
+around each top_call(). It names each bracket over semihosting. The
+instructions between the markers are counted, less those of an empty
+bracket. The driver also paints the stack before each call and reports the
+deepest byte the call touched. Counts come from QEMU's instruction stream,
+not from a cycle model, but they are exact and repeatable.
+
+    python3 tools/qemu_count.py --variants exception_depth return_code_depth
+
+Needs arm-none-eabi-g++ and QEMU 8.1 or newer, for one-insn-per-tb.
+"""
+
+import argparse
+import csv
+import pathlib
+import re
+import subprocess
+import sys
+
+import elf_sections
+import toolchain
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+
+# Variant name -> source directory (relative to ROOT), compiler flags and
+# optional extra sources. Later flags win, so "-std=" here overrides the
+# default standard.
+VARIANTS = {
+    "exception": {"directory": "exception", "flags": []},
+    "exception_poly": {"directory": "exception_poly", "flags": []},
+    "exception_catch": {"directory": "exception_catch", "flags": []},
+    "exception_pooled": {
+        "directory": "exception",
+        "flags": ["-DEXCEPTION_POOL"],
+        "sources": [ROOT / "exception_pool" / "exception_pool.cpp"],
+    },
+    "return_code": {"directory": "return_code", "flags": []},
+    "std_expected": {"directory": "std_expected", "flags": ["-std=c++23"]},
+    "leaf": {"directory": "leaf", "flags": []},
+    "exception_depth": {"directory": "exception_depth", "flags": []},
+    "exception_depth_pooled": {
+        "directory": "exception_depth",
+        "flags": ["-DEXCEPTION_POOL"],
+        "sources": [ROOT / "exception_pool" / "exception_pool.cpp"],
+    },
+    "return_code_depth": {"directory": "return_code_depth", "flags": []},
+    "return_code_monadic_depth": {
+        "directory": "return_code_monadic_depth",
+        "flags": [],
+    },
+    "return_code_check_depth": {
+        "directory": "return_code_check_depth",
+        "flags": [],
+    },
+    "exception_virtual_depth": {
+        "directory": "exception_virtual_depth",
+        "flags": [],
+    },
+    "return_code_virtual_depth": {
+        "directory": "return_code_virtual_depth",
+        "flags": [],
+    },
+    "coroutine_depth": {
+        "directory": "coroutine_depth",
+        "flags": [f"-I{ROOT / 'coroutine_result'}"],
+    },
+    "coroutine_depth_arena": {
+        "directory": "coroutine_depth",
+        # Ample for the checked-in program's 15 frames deep chains, the
+        # sweep sizes the arena for deeper ones
+        "flags": [f"-I{ROOT / 'coroutine_result'}",
+                  "-DCOROUTINE_FRAME_ARENA_BYTES=65536"],
+    },
+    "std_expected_depth": {
+        "directory": "std_expected_depth",
+        "flags": ["-std=c++23"],
+    },
+    "leaf_depth": {"directory": "leaf_depth", "flags": []},
+    "compact_result_depth": {
+        "directory": "compact_result_depth",
+        "flags": [f"-I{ROOT / 'compact_result'}"],
+    },
+}
+
+ARM_FLAGS = ["-mcpu=cortex-m4", "-mthumb", "-mfloat-abi=hard",
+             "-mfpu=fpv4-sp-d16", "--specs=nano.specs", "--specs=nosys.specs"]
+
+PATHS = ["happy", "error"]
+
+# "Trace 0: 0x7f10c4000100 [00000000/000004d0/...] symbol", second field is
+# the guest PC
+_TRACE = re.compile(rb"^Trace \d+: \S+ \[[0-9a-f]+/([0-9a-f]+)/")
+
+
+def build(variant: str, args) -> pathlib.Path:
+    settings = VARIANTS[variant]
+    directory = args.build_dir / variant
+    directory.mkdir(parents=True, exist_ok=True)
+    image = directory / f"{variant}.elf"
+    command = [args.cxx, "-std=c++20", args.optimization, "-g",
+               *ARM_FLAGS, *settings["flags"],
+               "-DHOST_BENCHMARK",
+               f"-I{ROOT / 'host'}",
+               *(f"-I{include}" for include in args.include),
+               str(ROOT / settings["directory"] / "main.cpp"),
+               str(ROOT / "qemu" / "driver.cpp"),
+               *(str(extra) for extra in settings.get("sources", [])),
+               f"-T{ROOT / 'qemu' / 'mps2_an386.ld'}",
+               "-o", str(image)]
+    subprocess.run(command, check=True)
+    return image
+
+
+def run(image: pathlib.Path, args) -> tuple:
+    """Runs an image under QEMU
+
+    Returns the bracket names in order, the stack bytes used by each bracket
+    name's runs, and the path to the trace.
+    """
+    labels = image.with_suffix(".labels")
+    log = image.with_suffix(".log")
+    subprocess.run([args.qemu, "-M", args.machine,
+                    "-display", "none", "-serial", "none",
+                    "-monitor", "none",
+                    "-chardev", f"file,id=semihosting,path={labels}",
+                    "-semihosting-config",
+                    "enable=on,target=native,chardev=semihosting",
+                    "-accel", "tcg,one-insn-per-tb=on",
+                    "-d", "exec,nochain", "-D", str(log),
+                    "-kernel", str(image)],
+                   check=True, timeout=args.timeout)
+    brackets = []
+    stacks = {}
+    for line in labels.read_text().splitlines():
+        kind, name, *value = line.split()
+        if kind == "bracket":
+            brackets.append(name)
+        elif kind == "stack":
+            stacks.setdefault(name, []).append(int(value[0]))
+    return brackets, stacks, log
+
+
+def count_brackets(image: pathlib.Path, log: pathlib.Path) -> list:
+    """Instructions from each qemu_marker_start() to its qemu_marker_stop()"""
+    symbols = elf_sections.read_symbols(image)
+    # Thumb symbols have bit 0 set, QEMU logs the real address
+    start = symbols["qemu_marker_start"] & ~1
+    stop = symbols["qemu_marker_stop"] & ~1
+
+    counts = []
+    executed = 0
+    entered = None
+    with open(log, "rb") as trace:
+        for line in trace:
+            match = _TRACE.match(line)
+            if not match:
+                continue
+            pc = int(match.group(1), 16)
+            if pc == start:
+                entered = executed
+            elif pc == stop and entered is not None:
+                counts.append(executed - entered)
+                entered = None
+            executed += 1
+    return counts
+
+
+def measure(variant: str, compiler: str, args) -> dict:
+    image = build(variant, args)
+    labels, stacks, log = run(image, args)
+    counts = count_brackets(image, log)
+    if len(counts) != len(labels):
+        raise RuntimeError(f"{variant}: {len(labels)} brackets named but "
+                           f"{len(counts)} counted")
+    if not args.keep_logs:
+        log.unlink()
+
+    runs = {}
+    for label, count in zip(labels, counts):
+        runs.setdefault(label, []).append(count)
+    overhead = runs.pop("overhead")[0]
+
+    row = {
+        "variant": variant,
+        "compiler": compiler,
+        ".text": elf_sections.section_sizes(image).get(".text", 0),
+        "overhead": overhead,
+    }
+    for path in PATHS:
+        row[f"{path}_first"] = runs[path][0] - overhead
+        row[path] = runs[path][-1] - overhead
+        row[f"{path}_stack"] = max(stacks[path])
+    return row
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--variants", nargs="+",
+                        default=["exception", "return_code",
+                                 "exception_depth", "return_code_depth"],
+                        choices=list(VARIANTS))
+    parser.add_argument("--cxx", default="arm-none-eabi-g++")
+    parser.add_argument("-O", "--optimization", default="-Os")
+    parser.add_argument("-I", "--include", action="append", default=[],
+                        help="Extra include directory, e.g. for tl/expected")
+    parser.add_argument("--qemu", default="qemu-system-arm")
+    parser.add_argument("--machine", default="mps2-an386")
+    parser.add_argument("--timeout", default=600, type=int,
+                        help="Seconds to let one image run")
+    parser.add_argument("--keep-logs", action="store_true",
+                        help="Keep the instruction traces next to the images")
+    parser.add_argument("--build-dir", default=ROOT / "build" / "qemu",
+                        type=pathlib.Path)
+    parser.add_argument("-o", "--output", default="qemu.csv")
+    args = parser.parse_args()
+
+    compiler = toolchain.compiler_version(args.cxx)
+    fields = ["variant", "compiler", ".text", "overhead",
+              *(f"{path}{suffix}" for path in PATHS
+                for suffix in ("_first", "", "_stack"))]
+    with open(args.output, "w", newline="") as output:
+        writer = csv.DictWriter(output, fieldnames=fields)
+        writer.writeheader()
+        for variant in args.variants:
+            row = measure(variant, compiler, args)
+            writer.writerow(row)
+            print(f"{variant}: happy={row['happy']} error={row['error']} "
+                  f"instructions (first error {row['error_first']}), "
+                  f"stack {row['happy_stack']}/{row['error_stack']} bytes",
+                  file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
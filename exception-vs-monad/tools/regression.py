@@ -0,0 +1,263 @@
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compare benchmark results with a stored baseline and fail on regressions.
+
+Reads a CSV written by tools/sweep.py, tools/qemu_count.py or tools/eh_pool.py
+and the baseline of the same name in baselines/. Rows are matched by the
+columns that say what was built, such as the variant, grid point and
+optimization level. A sweep point's metrics are compared once, only the
+amortized latencies once per failure rate. Each gated metric may grow by its
+threshold, either a percentage of the baseline or an absolute amount.
+Anything that grows more is a regression. Every metric past its threshold
+either way is printed in a table, and the exit status is 1 if any of them
+regressed, or if a baseline row was not rerun unless --allow-missing is
+given.
+
+    python3 tools/sweep.py --target arm --groups 10 --depths 15 -o arm.csv
+    python3 tools/regression.py arm.csv
+    python3 tools/regression.py arm.csv --threshold .text=0 --threshold happy=1%
+
+--update stores the results as the new baseline instead. Latencies only
+compare on the machine the baseline was measured on. Section sizes and QEMU
+instruction counts compare anywhere with the same compiler.
+"""
+
+import argparse
+import csv
+import pathlib
+import shutil
+import sys
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+BASELINES = ROOT / "baselines"
+
+# Columns that say which build and run a row is, rather than what was
+# measured. Only those present in both files are used. error_size is what
+# the sweep asked for, where error_bytes is what the build made of it.
+IDENTITY = ["variant", "target", "groups", "depth", "translation_units",
+            "optimization", "lto", "objects", "trivial_objects",
+            "error_size", "failure_rate", "pool"]
+
+# tools/sweep.py writes one row per failure rate of a point, with the
+# point's own metrics repeated on each. Only these differ between the rows,
+# the rest is compared once per point.
+PER_RATE = ["amortized_ns", "amortized_p99_ns"]
+
+# Metric -> how much it may grow, gating image size, RAM and the error path.
+# Sizes and instruction counts are exact, so they get little room. Host
+# latencies get room for noise.
+THRESHOLDS = {
+    ".text": "0.5%",
+    ".rodata": "0.5%",
+    ".ARM.exidx": "0.5%",
+    ".ARM.extab": "0.5%",
+    ".eh_frame": "0.5%",
+    ".eh_frame_hdr": "0.5%",
+    ".gcc_except_table": "0.5%",
+    ".data": "0.5%",
+    ".bss": "0.5%",
+    # tools/qemu_count.py
+    "error": "1%",
+    "error_first": "1%",
+    "error_stack": "5%",
+    # tools/sweep.py on the host
+    "error_ns": "10%",
+    "error_p99_ns": "20%",
+    "error_first_ns": "20%",
+    "error_peak_stack_bytes": "5%",
+}
+
+
+class Threshold:
+    """How much a metric may grow, "5%" of the baseline or "64" absolute"""
+
+    def __init__(self, text: str):
+        self.text = text
+        self.relative = text.endswith("%")
+        self.amount = float(text.rstrip("%"))
+
+    def allowed(self, baseline: float) -> float:
+        if self.relative:
+            return abs(baseline) * self.amount / 100
+        return self.amount
+
+
+def parse_threshold(text: str) -> tuple:
+    """"error_ns=5%" -> ("error_ns", Threshold("5%"))"""
+    metric, separator, value = text.rpartition("=")
+    if not separator or not metric:
+        raise argparse.ArgumentTypeError(f"{text} is not metric=amount")
+    try:
+        threshold = Threshold(value)
+    except ValueError:
+        raise argparse.ArgumentTypeError(f"{value} is not a number or a "
+                                         "percentage")
+    if threshold.amount < 0:
+        raise argparse.ArgumentTypeError(f"{value} is negative")
+    return metric, threshold
+
+
+def read_rows(path: pathlib.Path) -> tuple:
+    with open(path, newline="") as results:
+        reader = csv.DictReader(results)
+        return reader.fieldnames or [], list(reader)
+
+
+def number(text: str):
+    """The value of a cell, None when it is empty or not a number"""
+    try:
+        return float(text)
+    except (TypeError, ValueError):
+        return None
+
+
+def compare(baseline_path: pathlib.Path, results_path: pathlib.Path,
+            thresholds: dict) -> tuple:
+    """Changes past their threshold, plus the baseline rows not rerun
+
+    Each change is (row name, metric, baseline, current, threshold).
+    """
+    baseline_fields, baseline_rows = read_rows(baseline_path)
+    result_fields, result_rows = read_rows(results_path)
+    identity = [field for field in IDENTITY
+                if field in baseline_fields and field in result_fields]
+
+    def key(row: dict) -> tuple:
+        return tuple(row[field] for field in identity)
+
+    def point_key(row: dict) -> tuple:
+        return tuple(row[field] for field in identity
+                     if field != "failure_rate")
+
+    # Rows are named by the columns that tell them apart
+    named = [field for field in identity if field == "variant"
+             or len({row[field] for row in baseline_rows}) > 1]
+
+    def name(row: dict, per_rate: bool = True) -> str:
+        return " ".join(f"{field}={row[field]}" if field != "variant"
+                        else row[field] for field in named
+                        if per_rate or field != "failure_rate")
+
+    baseline = {key(row): row for row in baseline_rows}
+    changes = []
+    compared = set()
+    compared_points = set()
+    for row in result_rows:
+        previous = baseline.get(key(row))
+        if previous is None:
+            continue
+        compared.add(key(row))
+        first_of_point = point_key(row) not in compared_points
+        compared_points.add(point_key(row))
+        for metric, threshold in thresholds.items():
+            per_rate = metric in PER_RATE
+            if not per_rate and not first_of_point:
+                continue
+            old = number(previous.get(metric))
+            new = number(row.get(metric))
+            if old is None or new is None:
+                continue
+            if abs(new - old) > threshold.allowed(old):
+                changes.append((name(row, per_rate), metric, old, new,
+                                threshold))
+    missing = [name(row) for row in baseline_rows
+               if key(row) not in compared]
+    return changes, missing
+
+
+def print_compilers(baseline_path: pathlib.Path, results_path: pathlib.Path):
+    """Says so when the baseline was built with another compiler"""
+    versions = []
+    for path in (baseline_path, results_path):
+        _, rows = read_rows(path)
+        versions.append(sorted({row.get("compiler") or "?" for row in rows}))
+    if versions[0] != versions[1]:
+        print(f"compiler: {', '.join(versions[0])} -> "
+              f"{', '.join(versions[1])}")
+
+
+def print_changes(changes: list):
+    def value(amount: float) -> str:
+        return f"{amount:.0f}" if amount == int(amount) else f"{amount:.2f}"
+
+    table = [("row", "metric", "baseline", "current", "change", "allowed",
+              "")]
+    for row, metric, old, new, threshold in changes:
+        change = (f"{(new - old) / old * 100:+.1f}%" if old
+                  else f"{new - old:+g}")
+        table.append((row, metric, value(old), value(new), change,
+                      threshold.text,
+                      "regressed" if new > old else "improved"))
+    widths = [max(len(line[column]) for line in table)
+              for column in range(len(table[0]))]
+    for line in table:
+        cells = [f"{line[0]:<{widths[0]}}", f"{line[1]:<{widths[1]}}",
+                 *(f"{cell:>{width}}"
+                   for cell, width in zip(line[2:6], widths[2:6])),
+                 line[6]]
+        print("  ".join(cells).rstrip())
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("results",
+                        help="CSV from tools/sweep.py, tools/qemu_count.py "
+                        "or tools/eh_pool.py",
+                        type=pathlib.Path)
+    parser.add_argument("--baseline", type=pathlib.Path,
+                        help="Baseline CSV, defaults to the file of the same "
+                        "name in baselines/")
+    parser.add_argument("--threshold", action="append", default=[],
+                        type=parse_threshold,
+                        help="metric=amount, e.g. error_ns=5%% or .text=64. "
+                        "Gates metrics that are not gated by default too")
+    parser.add_argument("--update", action="store_true",
+                        help="Store the results as the baseline")
+    parser.add_argument("--allow-missing", action="store_true",
+                        help="Pass even if baseline rows were not rerun")
+    args = parser.parse_args()
+
+    baseline = args.baseline or BASELINES / args.results.name
+    if args.update:
+        baseline.parent.mkdir(parents=True, exist_ok=True)
+        shutil.copyfile(args.results, baseline)
+        print(f"{args.results} is the baseline in {baseline}")
+        return 0
+    if not baseline.exists():
+        print(f"No baseline {baseline}, store one with --update",
+              file=sys.stderr)
+        return 2
+
+    thresholds = {metric: Threshold(text)
+                  for metric, text in THRESHOLDS.items()}
+    thresholds.update(args.threshold)
+    changes, missing = compare(baseline, args.results, thresholds)
+    print_compilers(baseline, args.results)
+    for row in missing:
+        print(f"not rerun: {row}")
+    if changes:
+        print_changes(changes)
+    regressions = sum(1 for change in changes if change[3] > change[2])
+    print(f"{regressions} regression(s) against {baseline}")
+    # A run that drops a variant or a point must not pass for that
+    if missing and not args.allow_missing:
+        print(f"{len(missing)} baseline row(s) not rerun, pass "
+              "--allow-missing if that is intended")
+        return 1
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
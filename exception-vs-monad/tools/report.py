@@ -0,0 +1,367 @@
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Summarize sweep results in one Markdown and one HTML report.
+
+Reads CSVs written by tools/sweep.py, or JSON files holding a list of rows
+with the same columns. Rows are grouped into settings: everything that was
+built the same way except the variant and the depth. Variants whose groups
+and depth stand for something else, such as exception_catch, are left out. For each setting with
+more than one depth the report has size and latency against depth charts,
+one line per strategy (variant). It also has the crossover points, the
+depths at which one strategy overtakes another, and a table at the deepest
+point.
+
+The HTML file draws the charts as inline SVG and needs nothing else. The
+Markdown file has the same tables and crossover points, without the charts.
+
+    python3 tools/sweep.py --groups 1 --depths 1..256 -o sweep.csv
+    python3 tools/report.py sweep.csv -o report
+"""
+
+import argparse
+import csv
+import html
+import json
+import math
+import pathlib
+import sys
+
+import sweep
+
+# Columns that, with the variant and depth, say what a row measured. Rows
+# that agree on all of them are one setting. These are what the sweep was
+# asked for, not measured layouts such as error_bytes, which can differ
+# between the points of one variant.
+SETTING = ["target", "groups", "translation_units", "optimization", "lto",
+           "objects", "trivial_objects", "error_size", "compiler"]
+
+# Variants the sweep maps its groups and depth onto other parameters for
+REMAPPED = {variant for variant, settings in sweep.VARIANTS.items()
+            if "grid" in settings}
+
+# Sections that only exist to unwind or to find landing pads
+UNWIND_TABLES = [".ARM.exidx", ".ARM.extab", ".eh_frame", ".eh_frame_hdr",
+                 ".gcc_except_table"]
+
+# Charted metrics, lower is better for all of them: (column, title, unit)
+METRICS = [
+    (".text", "Code size", "bytes"),
+    ("unwind_tables", "Unwind tables", "bytes"),
+    ("happy_ns", "Happy path latency", "ns"),
+    ("error_ns", "Error path latency", "ns"),
+]
+
+_COLORS = ["#1f77b4", "#d62728", "#2ca02c", "#ff7f0e", "#9467bd", "#8c564b",
+           "#e377c2", "#7f7f7f", "#bcbd22", "#17becf"]
+
+_WIDTH = 640
+_HEIGHT = 360
+# Room for the axis labels and the legend
+_LEFT = 72
+_RIGHT = 180
+_TOP = 32
+_BOTTOM = 48
+
+
+def number(text):
+    try:
+        return float(text)
+    except (TypeError, ValueError):
+        return None
+
+
+def read_rows(paths: list) -> list:
+    rows = []
+    for path in paths:
+        if path.suffix == ".json":
+            with open(path) as results:
+                rows += json.load(results)
+        else:
+            with open(path, newline="") as results:
+                rows += list(csv.DictReader(results))
+    for row in rows:
+        sizes = [number(row.get(section)) for section in UNWIND_TABLES]
+        row["unwind_tables"] = sum(size for size in sizes if size)
+    return rows
+
+
+def settings(rows: list) -> dict:
+    """Setting (tuple of (column, value)) -> variant -> depth -> row
+
+    The sweep writes one row per failure rate. The happy and error columns
+    are the same in each, so the first row of every point is kept.
+    """
+    grouped = {}
+    for row in rows:
+        if row["variant"] in REMAPPED:
+            continue
+        setting = tuple((column, str(row[column])) for column in SETTING
+                        if row.get(column) not in (None, ""))
+        depth = number(row.get("depth"))
+        if depth is None:
+            continue
+        points = grouped.setdefault(setting, {}).setdefault(row["variant"],
+                                                            {})
+        points.setdefault(depth, row)
+    return grouped
+
+
+def series(variants: dict, metric: str) -> dict:
+    """Variant -> sorted [(depth, value)] of one metric"""
+    lines = {}
+    for variant, points in variants.items():
+        line = [(depth, number(row.get(metric)))
+                for depth, row in sorted(points.items())]
+        line = [(depth, value) for depth, value in line if value is not None]
+        if line:
+            lines[variant] = line
+    return lines
+
+
+def crossovers(lines: dict) -> list:
+    """Where one strategy overtakes another
+
+    Returns (better, worse, from depth, to depth, estimated depth) for each
+    change of order between two consecutive depths both were measured at.
+    The estimate interpolates linearly between the two depths.
+    """
+    found = []
+    names = sorted(lines)
+    for index, first in enumerate(names):
+        for second in names[index + 1:]:
+            a = dict(lines[first])
+            b = dict(lines[second])
+            depths = sorted(set(a) & set(b))
+            for low, high in zip(depths, depths[1:]):
+                before = a[low] - b[low]
+                after = a[high] - b[high]
+                if before == 0 or after == 0 or (before > 0) == (after > 0):
+                    continue
+                estimate = low + (high - low) * before / (before - after)
+                better, worse = ((first, second) if after < 0
+                                 else (second, first))
+                found.append((better, worse, low, high, estimate))
+    return found
+
+
+def depth_text(depth: float) -> str:
+    return f"{depth:.0f}" if depth == int(depth) else f"{depth:.1f}"
+
+
+def value_text(value: float) -> str:
+    if value >= 100 or value == int(value):
+        return f"{value:,.0f}"
+    return f"{value:,.1f}"
+
+
+def tick_step(top: float) -> float:
+    """1, 2 or 5 times a power of ten, for four to ten ticks up to top"""
+    power = 10 ** math.floor(math.log10(top / 4))
+    return next(power * factor for factor in (1, 2, 5, 10)
+                if top / (power * factor) <= 10)
+
+
+def setting_title(setting: tuple) -> str:
+    return ", ".join(f"{column} {value}" for column, value in setting)
+
+
+def svg_chart(title: str, unit: str, lines: dict, colors: dict) -> str:
+    """Line chart of value against depth, depth on a log2 axis if it spans
+    at least three doublings"""
+    depths = sorted({depth for line in lines.values() for depth, _ in line})
+    values = [value for line in lines.values() for _, value in line]
+    logarithmic = depths[0] > 0 and depths[-1] / depths[0] >= 8
+    if logarithmic:
+        low, high = math.log2(depths[0]), math.log2(depths[-1])
+    else:
+        low, high = depths[0], depths[-1]
+    step = tick_step(max(values) or 1)
+    top = math.ceil(max(values) / step) * step or step
+
+    plot_width = _WIDTH - _LEFT - _RIGHT
+    plot_height = _HEIGHT - _TOP - _BOTTOM
+
+    def x(depth: float) -> float:
+        position = math.log2(depth) if logarithmic else depth
+        share = (position - low) / (high - low) if high > low else 0.5
+        return _LEFT + share * plot_width
+
+    def y(value: float) -> float:
+        return _TOP + plot_height * (1 - value / top)
+
+    parts = [f'<svg xmlns="http://www.w3.org/2000/svg" width="{_WIDTH}" '
+             f'height="{_HEIGHT}" font-family="sans-serif" font-size="11">',
+             f'<text x="{_LEFT}" y="18" font-size="13" font-weight="bold">'
+             f'{html.escape(title)}</text>',
+             f'<line x1="{_LEFT}" y1="{_TOP + plot_height}" '
+             f'x2="{_LEFT + plot_width}" y2="{_TOP + plot_height}" '
+             'stroke="black"/>',
+             f'<line x1="{_LEFT}" y1="{_TOP}" x2="{_LEFT}" '
+             f'y2="{_TOP + plot_height}" stroke="black"/>']
+    for depth in depths:
+        parts.append(f'<text x="{x(depth):.1f}" y="{_TOP + plot_height + 16}"'
+                     f' text-anchor="middle">{depth_text(depth)}</text>')
+    parts.append(f'<text x="{_LEFT + plot_width / 2}" y="{_HEIGHT - 8}" '
+                 'text-anchor="middle">depth</text>')
+    for tick in range(round(top / step) + 1):
+        value = tick * step
+        parts.append(f'<line x1="{_LEFT}" y1="{y(value):.1f}" '
+                     f'x2="{_LEFT + plot_width}" y2="{y(value):.1f}" '
+                     'stroke="#ddd"/>')
+        parts.append(f'<text x="{_LEFT - 6}" y="{y(value) + 4:.1f}" '
+                     f'text-anchor="end">{value_text(value)}</text>')
+    parts.append(f'<text x="14" y="{_TOP + plot_height / 2}" '
+                 f'transform="rotate(-90 14 {_TOP + plot_height / 2})" '
+                 f'text-anchor="middle">{html.escape(unit)}</text>')
+    for index, (variant, line) in enumerate(sorted(lines.items())):
+        color = colors[variant]
+        points = " ".join(f"{x(depth):.1f},{y(value):.1f}"
+                          for depth, value in line)
+        parts.append(f'<polyline points="{points}" fill="none" '
+                     f'stroke="{color}" stroke-width="2"/>')
+        for depth, value in line:
+            parts.append(f'<circle cx="{x(depth):.1f}" cy="{y(value):.1f}" '
+                         f'r="2.5" fill="{color}"/>')
+        legend_y = _TOP + 14 * index
+        parts.append(f'<rect x="{_WIDTH - _RIGHT + 12}" y="{legend_y}" '
+                     f'width="10" height="10" fill="{color}"/>')
+        parts.append(f'<text x="{_WIDTH - _RIGHT + 26}" y="{legend_y + 9}">'
+                     f'{html.escape(variant)}</text>')
+    parts.append("</svg>")
+    return "\n".join(parts)
+
+
+def deepest_table(variants: dict) -> tuple:
+    """Header and rows of every metric at each variant's deepest point"""
+    header = ["variant", "depth",
+              *(f"{title} ({unit})" for _, title, unit in METRICS)]
+    table = []
+    for variant, points in sorted(variants.items()):
+        depth = max(points)
+        row = points[depth]
+        cells = [variant, depth_text(depth)]
+        for metric, _, _ in METRICS:
+            value = number(row.get(metric))
+            cells.append("" if value is None else value_text(value))
+        table.append(cells)
+    return header, table
+
+
+def crossover_lines(metric_title: str, found: list) -> list:
+    return [f"{metric_title}: {better} beats {worse} from about depth "
+            f"{depth_text(estimate)} (between {depth_text(low)} and "
+            f"{depth_text(high)})"
+            for better, worse, low, high, estimate in found]
+
+
+def build_report(rows: list) -> list:
+    """One section per setting with more than one depth
+
+    Each is (title, deepest table, [(metric title, unit, lines)], crossover
+    lines).
+    """
+    sections = []
+    for setting, variants in sorted(settings(rows).items()):
+        depths = {depth for points in variants.values() for depth in points}
+        if len(depths) < 2:
+            continue
+        charts = []
+        found = []
+        for metric, title, unit in METRICS:
+            lines = series(variants, metric)
+            if not lines:
+                continue
+            charts.append((title, unit, lines))
+            found += crossover_lines(title, crossovers(lines))
+        sections.append((setting_title(setting), deepest_table(variants),
+                         charts, found))
+    return sections
+
+
+def markdown(sections: list, sources: list) -> str:
+    text = ["# exception-vs-monad results", "",
+            f"From {', '.join(str(source) for source in sources)}.", ""]
+    for title, (header, table), _, found in sections:
+        text += [f"## {title}", "", "At the deepest point:", "",
+                 "| " + " | ".join(header) + " |",
+                 "|" + "|".join(" --- " for _ in header) + "|"]
+        text += ["| " + " | ".join(cells) + " |" for cells in table]
+        text += ["", "Crossover points:", ""]
+        text += [f"- {line}" for line in found] or ["- None, the order of "
+                                                   "the strategies never "
+                                                   "changes"]
+        text.append("")
+    return "\n".join(text)
+
+
+def html_report(sections: list, sources: list) -> str:
+    variants = sorted({variant for _, _, charts, _ in sections
+                       for _, _, lines in charts for variant in lines})
+    colors = {variant: _COLORS[index % len(_COLORS)]
+              for index, variant in enumerate(variants)}
+    body = ["<h1>exception-vs-monad results</h1>",
+            f"<p>From {html.escape(', '.join(map(str, sources)))}.</p>"]
+    for title, (header, table), charts, found in sections:
+        body.append(f"<h2>{html.escape(title)}</h2>")
+        body += [svg_chart(chart, unit, lines, colors)
+                 for chart, unit, lines in charts]
+        body.append("<h3>Crossover points</h3><ul>")
+        body += [f"<li>{html.escape(line)}</li>" for line in found] or [
+            "<li>None, the order of the strategies never changes</li>"]
+        body.append("</ul><h3>At the deepest point</h3><table><tr>")
+        body += [f"<th>{html.escape(cell)}</th>" for cell in header]
+        body.append("</tr>")
+        for cells in table:
+            body.append("<tr>" + "".join(f"<td>{html.escape(cell)}</td>"
+                                         for cell in cells) + "</tr>")
+        body.append("</table>")
+    return "\n".join([
+        "<!DOCTYPE html>",
+        '<html><head><meta charset="utf-8">',
+        "<title>exception-vs-monad results</title>",
+        "<style>body{font-family:sans-serif;max-width:980px;margin:auto}"
+        "svg{margin:8px 0}table{border-collapse:collapse}"
+        "th,td{border:1px solid #ccc;padding:2px 8px;text-align:right}"
+        "th:first-child,td:first-child{text-align:left}</style>",
+        "</head><body>", *body, "</body></html>", ""])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("results", nargs="+", type=pathlib.Path,
+                        help="CSV from tools/sweep.py, or JSON rows")
+    parser.add_argument("-o", "--output", default="report",
+                        help="Writes OUTPUT.md and OUTPUT.html")
+    args = parser.parse_args()
+
+    rows = read_rows(args.results)
+    for variant in sorted({row["variant"] for row in rows} & REMAPPED):
+        print(f"Leaving out {variant}, its groups and depth are not call "
+              "chains", file=sys.stderr)
+    sections = build_report(rows)
+    if not sections:
+        print("No setting was measured at more than one depth",
+              file=sys.stderr)
+        return 1
+    sources = [path.name for path in args.results]
+    pathlib.Path(f"{args.output}.md").write_text(markdown(sections, sources))
+    pathlib.Path(f"{args.output}.html").write_text(
+        html_report(sections, sources))
+    print(f"Wrote {args.output}.md and {args.output}.html", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,163 @@
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Worst case stack depth from GCC's -fcallgraph-info=su output.
+
+Compile with `-fcallgraph-info=su` and GCC writes a .ci file per translation
+unit with every function's frame size and its direct callees. This adds the
+frames up along the deepest path from the root function, by default
+harness::call_top().
+
+Only what the compiler sees is counted. Callees in other translation units or
+libraries, such as __cxa_throw and the whole unwinder, count as zero and are
+listed as unknown. Dynamic frames (alloca, variable length arrays) count with
+their static part and are listed too. The stack painting in the host and QEMU
+drivers covers what this misses.
+
+    g++ -fcallgraph-info=su -c main.cpp
+    python3 tools/stack_usage.py main.ci
+"""
+
+import argparse
+import re
+import sys
+
+DEFAULT_ROOT = "_ZN7harness8call_topEv"
+
+_NODE = re.compile(r'^node: \{ title: "([^"]+)" label: "([^"]*)"(.*)\}$')
+_EDGE = re.compile(r'^edge: \{ sourcename: "([^"]+)" targetname: "([^"]+)"')
+_FRAME = re.compile(r"\\n(\d+) bytes \(([a-z,]+)\)$")
+
+
+def symbol(title: str) -> str:
+    """Drops the "file:" prefix GCC puts on functions with internal linkage"""
+    return title.rsplit(":", 1)[-1]
+
+
+class CallGraph:
+    def __init__(self):
+        # Function -> (frame bytes, qualifier), only for defined functions
+        self.frames = {}
+        self.callees = {}
+
+    def read(self, path: str):
+        with open(path) as graph:
+            for line in graph:
+                node = _NODE.match(line)
+                if node:
+                    frame = _FRAME.search(node.group(2))
+                    if frame and "ellipse" not in node.group(3):
+                        self.frames[symbol(node.group(1))] = (
+                            int(frame.group(1)), frame.group(2))
+                    continue
+                edge = _EDGE.match(line)
+                if edge:
+                    self.callees.setdefault(symbol(edge.group(1)), set()).add(
+                        symbol(edge.group(2)))
+
+    def deepest(self, root: str) -> tuple:
+        """Bytes and call path of the deepest chain of frames from root
+
+        Recursion cannot be bounded statically, so a call back into a
+        function already on the path is reported instead of followed.
+        """
+        depths = {}
+        recursive = set()
+        on_path = set()
+
+        def visit(function: str) -> tuple:
+            if function in depths:
+                return depths[function]
+            if function not in self.frames:
+                return 0, [function]
+            on_path.add(function)
+            deepest_callee = (0, [])
+            for callee in sorted(self.callees.get(function, ())):
+                if callee in on_path:
+                    recursive.add(callee)
+                    continue
+                deepest_callee = max(deepest_callee, visit(callee),
+                                     key=lambda result: result[0])
+            on_path.discard(function)
+            total, path = deepest_callee
+            depths[function] = (self.frames[function][0] + total,
+                                [function, *path])
+            return depths[function]
+
+        total, path = visit(root)
+        return total, path, sorted(recursive)
+
+    def reachable(self, root: str) -> set:
+        seen = set()
+        pending = [root]
+        while pending:
+            function = pending.pop()
+            if function in seen:
+                continue
+            seen.add(function)
+            pending.extend(self.callees.get(function, ()))
+        return seen
+
+    def unknown(self, root: str) -> list:
+        """Functions reachable from root whose frames are not known"""
+        return sorted(function for function in self.reachable(root)
+                      if function not in self.frames)
+
+    def dynamic(self, root: str) -> list:
+        """Functions reachable from root with a dynamically sized frame"""
+        return sorted(function for function in self.reachable(root)
+                      if function in self.frames
+                      and self.frames[function][1] != "static")
+
+
+def read_call_graph(paths: list) -> CallGraph:
+    graph = CallGraph()
+    for path in paths:
+        graph.read(str(path))
+    return graph
+
+
+def static_stack_bytes(paths: list, root: str = DEFAULT_ROOT) -> int:
+    """Deepest frame sum from root over the given .ci files"""
+    return read_call_graph(paths).deepest(root)[0]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("call_graphs", nargs="+",
+                        help=".ci files written by -fcallgraph-info=su")
+    parser.add_argument("--root", default=DEFAULT_ROOT,
+                        help="Mangled name of the function to start from")
+    args = parser.parse_args()
+
+    graph = read_call_graph(args.call_graphs)
+    if args.root not in graph.frames:
+        print(f"{args.root} is not in the call graph", file=sys.stderr)
+        return 1
+    total, path, recursive = graph.deepest(args.root)
+    print(f"{total} bytes along:")
+    for function in path:
+        frame = graph.frames.get(function)
+        size = f"{frame[0]:>8}" if frame else f"{'?':>8}"
+        print(f"{size}  {function}")
+    for title, functions in (("unknown frames", graph.unknown(args.root)),
+                             ("dynamic frames", graph.dynamic(args.root)),
+                             ("recursion not followed", recursive)):
+        if functions:
+            print(f"{title}: {' '.join(functions)}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
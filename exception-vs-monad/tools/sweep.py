@@ -0,0 +1,668 @@
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generate, build and measure the depth benchmarks over a groups x depth grid.
+
+Every point of the grid is generated with the variant's generate_functions.py,
+compiled straight with the compiler (no CMake or conan per point), then the
+section sizes are read from the linked image. Host images are also run to get
+the median and p99 of the happy and error path latency and of the amortized
+latency at each failure rate. All results end up in one CSV file, with one row
+per failure rate.
+
+    python3 tools/sweep.py --groups 1..64 --depths 1..256 -I ~/include
+
+Host runs also time the very first call of each path, in fresh processes
+with cold caches (--cold-trials).
+
+Every image is also built with -fcallgraph-info=su to get the worst case stack
+depth the compiler can see. Host runs add the peak stack each path really
+touched, unwinder included.
+
+The size of error_t can be swept too, e.g. `--error-sizes 4..512`. Every row
+then says how big the result of each frame is and whether the target's calling
+convention returns it in registers.
+
+Each program can also be split over several translation units with
+`--translation-units 1,4`, and built at several optimization levels with and
+without LTO, e.g. `-O Os,O2,O3 --lto both`, to see what cross unit inlining
+does to each error strategy.
+
+Every row also says how long the generated sources took to compile and link,
+in wall and CPU seconds, and the peak resident memory of the compiler.
+
+The objects with destructors in each frame can be swept with `--objects 0..16`,
+and `--trivial-objects both` adds the same points with trivially destructible
+objects as controls. Every row has the average code, cold code and unwind
+table bytes of one frame, to see how landing pads grow with the objects.
+
+Grid values are comma separated. `a..b` expands to the powers of two from a to
+b, both included, so `1..8,12` means 1, 2, 4, 8 and 12. `0..4` means 0, 1, 2
+and 4.
+"""
+
+import argparse
+import concurrent.futures
+import csv
+import json
+import os
+import pathlib
+import re
+import subprocess
+import sys
+import time
+
+import elf_sections
+import function_sizes
+import stack_usage
+import toolchain
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+
+# Variant name -> generator arguments (relative to ROOT), compiler flags and
+# optional extra sources. Later flags win, so "-std=" here overrides the
+# default standard.
+VARIANTS = {
+    "exception_depth": {
+        "generator": ["exception_depth/generate_functions.py"],
+        "flags": [],
+    },
+    "exception_depth_pooled": {
+        "generator": ["exception_depth/generate_functions.py"],
+        "flags": ["-DEXCEPTION_POOL"],
+        "sources": [ROOT / "exception_pool" / "exception_pool.cpp"],
+    },
+    "return_code_depth": {
+        "generator": ["return_code_depth/generate_functions.py"],
+        "flags": [],
+    },
+    "return_code_monadic_depth": {
+        "generator": ["return_code_depth/generate_functions.py",
+                      "--style", "monadic"],
+        "flags": [],
+    },
+    "return_code_check_depth": {
+        "generator": ["return_code_depth/generate_functions.py",
+                      "--style", "check"],
+        "flags": [],
+    },
+    "exception_virtual_depth": {
+        "generator": ["exception_depth/generate_functions.py",
+                      "--dispatch", "virtual"],
+        "flags": [],
+    },
+    "return_code_virtual_depth": {
+        "generator": ["return_code_depth/generate_functions.py",
+                      "--dispatch", "virtual"],
+        "flags": [],
+    },
+    "coroutine_depth": {
+        "generator": ["return_code_depth/generate_functions.py",
+                      "--style", "coroutine"],
+        "flags": [f"-I{ROOT / 'coroutine_result'}",
+                  "-DHOST_BENCHMARK_COROUTINES"],
+    },
+    "coroutine_depth_arena": {
+        "generator": ["return_code_depth/generate_functions.py",
+                      "--style", "coroutine"],
+        "flags": [f"-I{ROOT / 'coroutine_result'}",
+                  "-DHOST_BENCHMARK_COROUTINES"],
+        "frame_arena": True,
+    },
+    "std_expected_depth": {
+        "generator": ["return_code_depth/generate_functions.py",
+                      "--library", "std"],
+        "flags": ["-std=c++23"],
+    },
+    "compact_result_depth": {
+        "generator": ["return_code_depth/generate_functions.py",
+                      "--library", "compact"],
+        "flags": [f"-I{ROOT / 'compact_result'}"],
+    },
+    "leaf_depth": {
+        "generator": ["return_code_depth/generate_functions.py",
+                      "--library", "leaf"],
+        "flags": [],
+    },
+    # Groups are catch clauses and depth is the depth of the class hierarchy
+    # of the thrown error
+    "exception_catch": {
+        "generator": ["exception_catch/generate_functions.py"],
+        "grid": ("--catch_clauses", "--hierarchy_depth"),
+        "splits": False,
+        "objects": False,
+        "flags": [],
+        "flat_baseline": True,
+    },
+    # The graphs set their own objects per function with --destructors
+    "exception_graph": {
+        "generator": ["call_graph/generate_functions.py",
+                      "--style", "exception"],
+        "objects": False,
+        "flags": [],
+    },
+    "return_code_graph": {
+        "generator": ["call_graph/generate_functions.py",
+                      "--style", "expected"],
+        "objects": False,
+        "flags": [],
+    },
+}
+
+TARGETS = {
+    "host": {
+        "cxx": "g++",
+        "optimization": "O2",
+        "flags": ["-DHOST_BENCHMARK"],
+        "sources": [ROOT / "host" / "driver.cpp",
+                    ROOT / "host" / "benchmark.cpp",
+                    ROOT / "host" / "cold_start.cpp",
+                    ROOT / "host" / "event_counters.cpp",
+                    ROOT / "host" / "heap.cpp",
+                    ROOT / "host" / "stack_usage.cpp"],
+        "libraries": ["-pthread"],
+        "runs": True,
+        # Where the static stack depth is counted from
+        "call_graph_root": "_ZN7harness8call_topEv",
+        # x86-64 System V and AArch64 return up to 16 bytes in two registers
+        "register_return_bytes": 16,
+    },
+    "arm": {
+        "cxx": "arm-none-eabi-g++",
+        "optimization": "Os",
+        "flags": ["-mcpu=cortex-m4", "-mthumb", "-mfloat-abi=hard",
+                  "-mfpu=fpv4-sp-d16", "--specs=nano.specs",
+                  "--specs=nosys.specs"],
+        "sources": [],
+        "libraries": [],
+        "runs": False,
+        "call_graph_root": "main",
+        # AAPCS returns composite types larger than 4 bytes through memory
+        "register_return_bytes": 4,
+    },
+}
+
+# Coroutine frames the host driver reports for one call of each path
+FRAME_USAGE = ["frames_per_call", "frame_bytes_per_call",
+               "frame_high_water_bytes"]
+
+# Hardware events reported by the host driver with --counters on
+EVENTS = ["cycles", "instructions", "branches", "branch_misses",
+          "l1d_read_misses", "l1i_read_misses"]
+
+# What compiling and linking each point cost, see build()
+BUILD_COSTS = ["source_lines", "compile_wall_s", "compile_cpu_s",
+               "compile_peak_rss_kib", "link_wall_s", "link_cpu_s",
+               "link_peak_rss_kib"]
+
+SECTIONS = [".text", ".rodata", ".ARM.exidx", ".ARM.extab", ".eh_frame",
+            ".eh_frame_hdr", ".gcc_except_table"]
+
+# Objects per frame the depth generators write unless told otherwise
+DEFAULT_OBJECTS = 2
+
+# Average bytes of one generated frame, see frame_sizes()
+FRAME_SIZES = ["frame_text_bytes", "frame_cold_bytes", "frame_lsda_bytes",
+               "frame_unwind_bytes"]
+
+
+class Point:
+    def __init__(self, variant: str, groups: int, depth: int, error_size: int,
+                 translation_units: int, optimization: str, lto: bool,
+                 objects: int = DEFAULT_OBJECTS,
+                 trivial_objects: bool = False):
+        self.variant = variant
+        self.groups = groups
+        self.depth = depth
+        self.error_size = error_size
+        self.translation_units = translation_units
+        self.optimization = optimization
+        self.lto = lto
+        self.objects = objects
+        self.trivial_objects = trivial_objects
+
+    @property
+    def name(self) -> str:
+        units = (f"_u{self.translation_units}"
+                 if self.translation_units > 1 else "")
+        objects = ""
+        if self.objects != DEFAULT_OBJECTS or self.trivial_objects:
+            objects = f"_o{self.objects}{'t' if self.trivial_objects else ''}"
+        lto = "_lto" if self.lto else ""
+        return (f"{self.variant}_g{self.groups}_d{self.depth}"
+                f"_e{self.error_size}{units}{objects}_{self.optimization}"
+                f"{lto}")
+
+
+def parse_grid(text: str) -> list:
+    values = []
+    for item in text.split(","):
+        if ".." in item:
+            low, high = (int(bound) for bound in item.split(".."))
+            if low == 0:
+                # Doubling never gets past zero
+                values.append(0)
+                low = 1
+            value = low
+            while value <= high:
+                values.append(value)
+                value *= 2
+        else:
+            values.append(int(item))
+    return sorted(set(values))
+
+
+def parse_levels(text: str) -> list:
+    """"Os,O2" -> ["Os", "O2"], also accepting a leading dash"""
+    return [level.lstrip("-") for level in text.split(",")]
+
+
+def unsupported(point: Point) -> str:
+    """Why the point's variant cannot be built that way, None when it can"""
+    settings = VARIANTS[point.variant]
+    if (not settings.get("objects", True)
+            and (point.objects != DEFAULT_OBJECTS or point.trivial_objects)):
+        return "has no objects per frame to set"
+    if not settings.get("splits", True) and point.translation_units > 1:
+        return "cannot be split into units"
+    return None
+
+
+def generate(point: Point, directory: pathlib.Path) -> list:
+    """Generates the point's sources, main.cpp plus one file per extra unit"""
+    settings = VARIANTS[point.variant]
+    generator = settings["generator"]
+    groups, depth = settings.get("grid", ("--max_groups", "--max_depth"))
+    command = [sys.executable, str(ROOT / generator[0]), *generator[1:],
+               groups, str(point.groups),
+               depth, str(point.depth),
+               "--error_size", str(point.error_size)]
+    if settings.get("objects", True):
+        command += ["--objects", str(point.objects)]
+        if point.trivial_objects:
+            command.append("--trivial_objects")
+    if settings.get("splits", True):
+        subprocess.run([*command,
+                        "--translation_units", str(point.translation_units),
+                        "--output_directory", str(directory)],
+                       check=True)
+    else:
+        with open(directory / "main.cpp", "w") as output:
+            subprocess.run(command, stdout=output, check=True)
+    return [directory / "main.cpp",
+            *(directory / f"unit{unit}.cpp"
+              for unit in range(1, point.translation_units))]
+
+
+def pool_flags(point: Point) -> list:
+    """Sizes the static exception pool's slots for the point's thrown error"""
+    if "-DEXCEPTION_POOL" not in VARIANTS[point.variant]["flags"]:
+        return []
+    object_size = max(256, (point.error_size + 15) // 16 * 16)
+    return [f"-DEXCEPTION_POOL_OBJECT_SIZE={object_size}"]
+
+
+def arena_flags(point: Point) -> list:
+    """Sizes the static coroutine frame arena for the point's deepest chain
+
+    Only one group's chain is alive at a time, its frames plus top_call()'s
+    and return_error()'s. A frame keeps the awaited results that hold an
+    error_t, a few per object. The estimate stays above what
+    coroutine_depth reports as frame_high_water_bytes.
+    """
+    if not VARIANTS[point.variant].get("frame_arena"):
+        return []
+    frame_bytes = (point.objects + 1) * (4 * point.error_size + 64) + 128
+    arena_bytes = (point.depth + 3) * frame_bytes
+    arena_bytes = max(65536, (arena_bytes + 4095) // 4096 * 4096)
+    return [f"-DCOROUTINE_FRAME_ARENA_BYTES={arena_bytes}"]
+
+
+def compile_command(point: Point, args) -> list:
+    target = TARGETS[args.target]
+    return [args.cxx or target["cxx"], "-std=c++20",
+            f"-{point.optimization}", *(["-flto"] if point.lto else []),
+            *target["flags"], *VARIANTS[point.variant]["flags"],
+            *pool_flags(point), *arena_flags(point),
+            f'-DHOST_BENCHMARK_VARIANT="{point.variant}"',
+            f"-I{ROOT / 'host'}",
+            *(f"-I{include}" for include in args.include)]
+
+
+def run_measured(command: list, directory: pathlib.Path) -> dict:
+    """Runs a compiler command, returning its wall time, CPU time and peak RSS
+
+    The driver waits for cc1plus, as, collect2 and lto1 in turn, so their
+    resource usage is included and the peak is that of the largest one.
+    """
+    start = time.perf_counter()
+    process = subprocess.Popen(command, cwd=directory)
+    _, status, usage = os.wait4(process.pid, 0)
+    wall = time.perf_counter() - start
+    process.returncode = os.waitstatus_to_exitcode(status)
+    if process.returncode != 0:
+        raise subprocess.CalledProcessError(process.returncode, command)
+    return {"wall_s": wall, "cpu_s": usage.ru_utime + usage.ru_stime,
+            # Linux reports kilobytes
+            "peak_rss_kib": usage.ru_maxrss}
+
+
+def build(point: Point, args) -> tuple:
+    """Builds a point's image, returning it and what building it cost
+
+    The generated sources are compiled on their own so that their compile
+    time is not mixed up with the driver's. Linking is timed separately, as
+    with -flto that is where the code is generated.
+    """
+    target = TARGETS[args.target]
+    directory = args.build_dir / args.target / point.name
+    directory.mkdir(parents=True, exist_ok=True)
+
+    sources = generate(point, directory)
+    extras = [*target["sources"], *VARIANTS[point.variant].get("sources", [])]
+    # GCC writes the objects and .ci files into the working directory
+    compile_cost = run_measured(
+        [*compile_command(point, args), "-c",
+         *(str(source) for source in sources), "-fcallgraph-info=su"],
+        directory)
+    if extras:
+        subprocess.run([*compile_command(point, args), "-c",
+                        *(str(extra) for extra in extras)],
+                       cwd=directory, check=True)
+    image = directory / f"{point.variant}.elf"
+    objects = [directory / pathlib.Path(source).with_suffix(".o").name
+               for source in [*sources, *extras]]
+    link_cost = run_measured(
+        [*compile_command(point, args),
+         *(str(path) for path in objects), *target["libraries"],
+         "-o", str(image)],
+        directory)
+
+    lines = 0
+    for source in sources:
+        with open(source) as text:
+            lines += sum(1 for _ in text)
+    if point.translation_units > 1:
+        with open(directory / "common.hpp") as text:
+            lines += sum(1 for _ in text)
+    cost = {"source_lines": lines}
+    for step, measured in (("compile", compile_cost), ("link", link_cost)):
+        cost.update({f"{step}_{key}": round(value, 3)
+                     for key, value in measured.items()})
+    return image, cost
+
+
+def static_stack_bytes(image: pathlib.Path, args):
+    """Deepest frame sum the compiler reports from the target's root
+
+    None when there is no call graph for the root, as with -flto, where the
+    code is only generated at link time.
+    """
+    graph = stack_usage.read_call_graph(sorted(image.parent.glob("*.ci")))
+    root = TARGETS[args.target]["call_graph_root"]
+    if root not in graph.frames:
+        return None
+    return graph.deepest(root)[0]
+
+
+def frame_sizes(image: pathlib.Path) -> dict:
+    """Average bytes of one generated frame, by what they are for
+
+    From -O2 up GCC moves a function's landing pads and other unlikely code
+    into a separate .cold part, which is frame_cold_bytes. The LSDA
+    (.gcc_except_table or .ARM.extab) lists the landing pads, the unwind
+    bytes are the frame's .eh_frame FDE or .ARM.exidx entries. Empty when
+    the image has no generated frames.
+    """
+    pattern = re.compile(function_sizes.FRAME_PATTERN)
+    frames = set()
+    totals = dict.fromkeys(FRAME_SIZES, 0)
+    for function, sizes in function_sizes.attribute(str(image)).items():
+        match = pattern.search(function) if function else None
+        if not match:
+            continue
+        frames.add(match.group(0))
+        code = ("frame_cold_bytes" if function.endswith(".cold")
+                else "frame_text_bytes")
+        totals[code] += sizes.get(".text", 0)
+        totals["frame_lsda_bytes"] += (sizes.get(".gcc_except_table", 0) +
+                                       sizes.get(".ARM.extab", 0))
+        totals["frame_unwind_bytes"] += (sizes.get(".eh_frame", 0) +
+                                         sizes.get(".ARM.exidx", 0))
+    if not frames:
+        return {}
+    return {key: round(total / len(frames), 1)
+            for key, total in totals.items()}
+
+
+def read_layout(point: Point, args) -> dict:
+    """Reads harness::layout out of the generated source's assembly
+
+    The layout is a constant, so compiling with the host hooks is enough to
+    get it for targets that never run.
+    """
+    directory = args.build_dir / args.target / point.name
+    assembly = directory / "layout.s"
+    # -fno-lto, since with -flto the assembly would be bytecode
+    subprocess.run([*compile_command(point, args), "-DHOST_BENCHMARK",
+                    "-fno-lto", "-S",
+                    str(directory / "main.cpp"), "-o", str(assembly)],
+                   check=True)
+    label = re.search(r"^_ZN7harness6layoutE:\n((?:\s+\..*\n)+)",
+                      assembly.read_text(), re.MULTILINE)
+    values = [int(value, 0) for value in re.findall(
+        r"\.(?:quad|long|word|value|short|byte|[248]byte)\s+(\w+)",
+        label.group(1))]
+    error_bytes, result_bytes, trivial_for_calls = values[:3]
+    limit = TARGETS[args.target]["register_return_bytes"]
+    return {
+        "error_bytes": error_bytes,
+        "result_bytes": result_bytes,
+        "result_in_registers":
+            int(bool(trivial_for_calls) and result_bytes <= limit),
+    }
+
+
+def run_driver(image: pathlib.Path, args) -> list:
+    """Runs a host image and returns the results list from its JSON output"""
+    output = subprocess.run([str(image),
+                             "--happy-iterations", str(args.happy_iterations),
+                             "--error-iterations", str(args.error_iterations),
+                             "--mixed-iterations", str(args.mixed_iterations),
+                             "--trials", str(args.trials),
+                             "--failure-rates", args.failure_rates,
+                             "--seed", str(args.seed),
+                             "--cold-trials", str(args.cold_trials),
+                             "--counters", "on" if args.counters else "off",
+                             "--json", "-"],
+                            capture_output=True, text=True, check=True)
+    return json.loads(output.stdout)["results"]
+
+
+def measure_runtime(image: pathlib.Path, args) -> list:
+    """One dict per failure rate, each with the happy and error latency"""
+    results = run_driver(image, args)
+    runtime = {}
+    for result in results:
+        if result["name"] in ("happy_first", "error_first"):
+            runtime[f"{result['name']}_ns"] = result["median_ns"]
+            runtime[f"{result['name']}_max_ns"] = result["max_ns"]
+        if result["name"] in ("happy", "error"):
+            runtime[f"{result['name']}_ns"] = result["median_ns"]
+            runtime[f"{result['name']}_p99_ns"] = result["p99_ns"]
+            runtime[f"{result['name']}_peak_stack_bytes"] = (
+                result["peak_stack_bytes"])
+            for key in FRAME_USAGE:
+                if key in result:
+                    runtime[f"{result['name']}_{key}"] = result[key]
+            for event in EVENTS:
+                key = f"{event}_per_call"
+                if key in result:
+                    runtime[f"{result['name']}_{key}"] = result[key]
+    return [dict(runtime, failure_rate=result["failure_rate"],
+                 amortized_ns=result["median_ns"],
+                 amortized_p99_ns=result["p99_ns"])
+            for result in results if result["name"] == "mixed"]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--variants", nargs="+",
+                        default=["exception_depth", "return_code_depth"],
+                        choices=list(VARIANTS))
+    parser.add_argument("-g", "--groups", default="1..64", type=parse_grid)
+    parser.add_argument("-d", "--depths", default="1..256", type=parse_grid)
+    parser.add_argument("-e", "--error-sizes", default="128", type=parse_grid,
+                        help="Bytes in error_t, at least 4")
+    parser.add_argument("--target", default="host", choices=list(TARGETS))
+    parser.add_argument("--cxx", help="Compiler, defaults to the target's")
+    parser.add_argument("-O", "--optimizations", type=parse_levels,
+                        help="Comma separated optimization levels, e.g. "
+                        "Os,O2,O3. Defaults to the target's")
+    parser.add_argument("-u", "--translation-units", default="1",
+                        type=parse_grid,
+                        help="Source files to spread each program over")
+    parser.add_argument("--lto", default="off", choices=["off", "on", "both"],
+                        help="Build with -flto, without or both")
+    parser.add_argument("--objects", default=str(DEFAULT_OBJECTS),
+                        type=parse_grid,
+                        help="Objects with destructors in each frame that "
+                        "passes the error on, 0 to 16")
+    parser.add_argument("--trivial-objects", default="off",
+                        choices=["off", "on", "both"],
+                        help="Make those objects trivially destructible, "
+                        "as a control")
+    # Compilers run in each point's build directory, so paths given relative
+    # to where the sweep was started are made absolute
+    parser.add_argument("-I", "--include", action="append", default=[],
+                        type=lambda path: pathlib.Path(path).resolve(),
+                        help="Extra include directory, e.g. for tl/expected")
+    parser.add_argument("--happy-iterations", default=10_000, type=int,
+                        help="Happy path calls per trial")
+    parser.add_argument("--error-iterations", default=1_000, type=int,
+                        help="Error path calls per trial")
+    parser.add_argument("--mixed-iterations", default=1_000, type=int,
+                        help="Mixed calls per trial")
+    parser.add_argument("--trials", default=20, type=int)
+    parser.add_argument("--failure-rates", default="0,0.001,0.01,0.1,0.5",
+                        help="Comma separated probabilities for mixed runs")
+    parser.add_argument("--seed", default=1, type=int)
+    parser.add_argument("--cold-trials", default=10, type=int,
+                        help="Fresh processes per path for the first call")
+    parser.add_argument("--counters", action="store_true",
+                        help="Also record hardware events per call")
+    parser.add_argument("-j", "--jobs", default=None, type=int,
+                        help="Points built at once. Use 1 for compile wall "
+                        "times that do not compete for cores")
+    parser.add_argument("--build-dir", default=ROOT / "build" / "sweep",
+                        type=lambda path: pathlib.Path(path).resolve())
+    parser.add_argument("-o", "--output", default="sweep.csv")
+    args = parser.parse_args()
+
+    levels = args.optimizations or [TARGETS[args.target]["optimization"]]
+    modes = {"off": [False], "on": [True], "both": [False, True]}
+    points = [Point(variant, groups, depth, error_size, units, level, lto,
+                    objects, trivial)
+              for variant in args.variants
+              for groups in args.groups
+              for depth in args.depths
+              for error_size in args.error_sizes
+              for units in args.translation_units
+              for objects in args.objects
+              for trivial in modes[args.trivial_objects]
+              for level in levels
+              for lto in modes[args.lto]]
+    # A sweep over several variants crosses settings that only some have
+    for point in points:
+        reason = unsupported(point)
+        if reason:
+            print(f"{point.name}: skipped, {point.variant} {reason}",
+                  file=sys.stderr)
+    points = [point for point in points if not unsupported(point)]
+
+    # Build in parallel, but measure one at a time so runs do not compete.
+    with concurrent.futures.ThreadPoolExecutor(args.jobs) as executor:
+        builds = list(executor.map(lambda point: build(point, args), points))
+
+    compiler = toolchain.compiler_version(
+        args.cxx or TARGETS[args.target]["cxx"])
+    fields = ["variant", "target", "compiler", "groups", "depth", "functions",
+              "translation_units", "optimization", "lto", "objects",
+              "trivial_objects", "error_size",
+              "error_bytes", "result_bytes", "result_in_registers", *SECTIONS,
+              *FRAME_SIZES,
+              *BUILD_COSTS,
+              "static_stack_bytes", "happy_peak_stack_bytes",
+              "error_peak_stack_bytes",
+              "happy_ns", "happy_p99_ns", "error_ns", "error_p99_ns",
+              "happy_first_ns", "happy_first_max_ns", "error_first_ns",
+              "error_first_max_ns",
+              *(f"{path}_{key}" for path in ("happy", "error")
+                for key in FRAME_USAGE),
+              "matching_ns",
+              "failure_rate", "amortized_ns", "amortized_p99_ns"]
+    if args.counters:
+        fields += [f"{path}_{event}_per_call"
+                   for path in ("happy", "error") for event in EVENTS]
+    # Error path latency of the one clause, depth one point of each build,
+    # for variants where the rest is measured against it
+    flat_error_ns = {}
+
+    def add_matching(point: Point, row: dict):
+        if not VARIANTS[point.variant].get("flat_baseline"):
+            return
+        key = (point.variant, point.error_size, point.translation_units,
+               point.objects, point.trivial_objects, point.optimization,
+               point.lto, row.get("failure_rate"))
+        if point.groups == 1 and point.depth == 1:
+            flat_error_ns[key] = row["error_ns"]
+        if key in flat_error_ns:
+            row["matching_ns"] = row["error_ns"] - flat_error_ns[key]
+
+    with open(args.output, "w", newline="") as output:
+        writer = csv.DictWriter(output, fieldnames=fields)
+        writer.writeheader()
+        for point, (image, cost) in zip(points, builds):
+            sizes = elf_sections.section_sizes(image)
+            row = {
+                "variant": point.variant,
+                "target": args.target,
+                "compiler": compiler,
+                "groups": point.groups,
+                "depth": point.depth,
+                "functions": point.groups * (point.depth + 1),
+                "translation_units": point.translation_units,
+                "optimization": point.optimization,
+                "lto": int(point.lto),
+                "objects": point.objects,
+                "trivial_objects": int(point.trivial_objects),
+                "error_size": point.error_size,
+                **read_layout(point, args),
+                **frame_sizes(image),
+                "static_stack_bytes": static_stack_bytes(image, args),
+                **cost,
+            }
+            row.update({name: sizes.get(name, 0) for name in SECTIONS})
+            if TARGETS[args.target]["runs"]:
+                for runtime in measure_runtime(image, args):
+                    measured = dict(row, **runtime)
+                    add_matching(point, measured)
+                    writer.writerow(measured)
+            else:
+                writer.writerow(row)
+            print(f"{point.name}: .text={row['.text']}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,24 @@
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""What built the results, recorded with them by the tools that build."""
+
+import subprocess
+
+
+def compiler_version(cxx: str) -> str:
+    """First line of `cxx --version`, to tell results of compiler bumps apart"""
+    output = subprocess.run([cxx, "--version"], capture_output=True,
+                            text=True, check=True).stdout
+    return output.splitlines()[0]